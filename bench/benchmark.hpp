@@ -0,0 +1,99 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file benchmark.hpp
+ * @brief Helpers for benchmark executables, timing full runs of networks and printing tables of results.
+ */
+
+#ifndef FCPP_BENCHMARK_H_
+#define FCPP_BENCHMARK_H_
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+
+//! @brief Namespace containing benchmarking helpers.
+namespace bench {
+
+
+/**
+ * @brief Runs a network of type N constructed from given initialisation values, returning the elapsed seconds.
+ *
+ * The function `f` is called on the network after the run and before its destruction
+ * (outside of the timed section), in order to collect results from its nodes.
+ */
+template <typename N, typename T, typename F>
+double timed_run(T const& init, F&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    N network{init};
+    network.run();
+    double elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    f(network);
+    return elapsed;
+}
+
+//! @brief Runs a network of type N constructed from given initialisation values, returning the elapsed seconds.
+template <typename N, typename T>
+double timed_run(T const& init) {
+    return timed_run<N>(init, [](N const&){});
+}
+
+//! @brief Peak resident memory of the current process, in MB (zero if not available).
+inline double peak_memory() {
+#ifdef _WIN32
+    return 0;
+#else
+    rusage r;
+    getrusage(RUSAGE_SELF, &r);
+#ifdef __APPLE__
+    return r.ru_maxrss / 1048576.0;
+#else
+    return r.ru_maxrss / 1024.0;
+#endif
+#endif
+}
+
+/**
+ * @brief Calls a function in a separate process (where available), waiting for it to terminate.
+ *
+ * In this way, the peak memory measured within `f` is not affected by previous measurements.
+ */
+template <typename F>
+void isolated(F&& f) {
+#ifdef _WIN32
+    f();
+#else
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0) {
+        f();
+        std::cout.flush();
+        _exit(0);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+#endif
+}
+
+//! @brief Prints a row of tab-separated values.
+template <typename T, typename... Ts>
+void row(std::ostream& o, T const& x, Ts const&... xs) {
+    o << x;
+    using expander = int[];
+    (void)expander{0, ((void)(o << "\t" << xs), 0)...};
+    o << std::endl;
+}
+
+
+}
+
+#endif // FCPP_BENCHMARK_H_
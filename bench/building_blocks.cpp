@@ -0,0 +1,155 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file building_blocks.cpp
+ * @brief Measures the per-round cost of the coordination building blocks used by the sample programs.
+ *
+ * Every building block is run on cliques of devices, so that every device has exactly
+ * the same number of neighbours (from 1 to 256). For each block and neighbourhood size,
+ * the average time of a round (in nanoseconds) and the average export size (in bytes)
+ * are printed as a table. Times are net of the time of the `empty` block, which runs
+ * no building block, so that network construction, connection and scheduling costs
+ * are excluded (its own row reports its raw time). Distances fed to collections and
+ * broadcasts are synthetic, so that the cost of computing them is not included.
+ */
+
+#include <sstream>
+#include <vector>
+
+#include "lib/fcpp.hpp"
+#include "bench/benchmark.hpp"
+
+//! @brief Final time of the round schedule (every device runs rounds at times 0, 1, ..., end_time).
+constexpr size_t end_time = 200;
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Names of the building blocks measured.
+constexpr char const* block_names[] = {
+    "empty", "bis_distance", "abf_distance", "flex_distance",
+    "sp_collection", "mp_collection", "wmp_collection",
+    "broadcast", "spawn"
+};
+
+
+//! @brief Namespace containing the libraries of coordination routines.
+namespace coordination {
+
+
+namespace tags {
+    //! @brief The building block to be run (index into block_names).
+    struct block {};
+
+    //! @brief The number of devices in the clique.
+    struct devices {};
+
+    //! @brief The total size of exports sent by the node.
+    struct export_bytes {};
+
+    //! @brief The number of rounds run by the node.
+    struct round_count {};
+}
+
+
+//! @brief Main function.
+MAIN() {
+    bool is_source = node.uid == 0;
+    // synthetic distance, consistent within the clique
+    double dist = node.uid;
+    auto adder = [](double x, double y) {
+        return x+y;
+    };
+    auto divider = [](double x, size_t n) {
+        return x/n;
+    };
+    auto multiplier = [](double x, double f) {
+        return x*f;
+    };
+    common::option<int> key;
+    if (is_source) key.emplace(0);
+    switch (node.storage(tags::block{})) {
+        case 1: bis_distance(CALL, is_source, 1, 100); break;
+        case 2: abf_distance(CALL, is_source); break;
+        case 3: flex_distance(CALL, is_source, 0.2, 100.0, 0.1, 10); break;
+        case 4: sp_collection(CALL, dist, 1.0, 0.0, adder); break;
+        case 5: mp_collection(CALL, dist, 1.0, 0.0, adder, divider); break;
+        case 6: wmp_collection(CALL, dist, 100.0, 1.0, adder, multiplier); break;
+        case 7: broadcast(CALL, dist, double(node.uid)); break;
+        case 8: spawn(CALL, [&](int k){
+                    return make_tuple(k, true);
+                }, key); break;
+    }
+    node.storage(tags::export_bytes{}) += node.msg_size();
+    node.storage(tags::round_count{}) += 1;
+}
+//! @brief Exports for the main function.
+FUN_EXPORT main_t = common::export_list<
+    bis_distance_t, abf_distance_t, flex_distance_t,
+    sp_collection_t<double, double>, mp_collection_t<double, double>, wmp_collection_t<double>,
+    broadcast_t<double, double>, spawn_t<int, bool>
+>;
+
+
+}
+
+
+}
+
+using namespace fcpp;
+using namespace component::tags;
+using namespace coordination::tags;
+
+//! @brief The sequence of node generation events (all devices generated at time 0).
+using spawn_s = sequence::multiple<
+    distribution::constant_i<size_t, devices>,
+    distribution::constant_n<double, 0>
+>;
+
+//! @brief The simulation options.
+DECLARE_OPTIONS(opt,
+    parallel<false>,
+    synchronised<false>,
+    message_size<true>,
+    program<coordination::main>,
+    exports<coordination::main_t>,
+    round_schedule<sequence::periodic_n<1, 0, 1, end_time>>,
+    spawn_schedule<spawn_s>,
+    tuple_store<
+        block,          int,
+        export_bytes,   size_t,
+        round_count,    size_t
+    >,
+    init<
+        x,      distribution::rect_n<1, 0, 0, 10, 10>,
+        block,  distribution::constant_i<int, block>
+    >,
+    connector<connect::fixed<100>>
+);
+
+int main() {
+    //! @brief The network object type (batch simulator with given options).
+    using net_t = component::batch_simulator<opt>::net;
+    std::stringstream log;
+    //! @brief The time (in nanoseconds) of a round of the empty block, for every neighbourhood size.
+    std::vector<double> baseline;
+    bench::row(std::cout, "block", "neighbours", "ns/round", "bytes/round");
+    for (int b = 0; b < 9; ++b)
+        for (size_t n = 1, k = 0; n <= 256; n *= 2, ++k) {
+            size_t bytes = 0, rounds = 0;
+            double t = bench::timed_run<net_t>(common::make_tagged_tuple<block, devices, output>(b, n+1, &log), [&](net_t& network){
+                for (size_t i = 0; i <= n; ++i) {
+                    bytes += network.node_at(i).storage(export_bytes{});
+                    rounds += network.node_at(i).storage(round_count{});
+                }
+            });
+            double ns = t * 1e9 / rounds;
+            if (b == 0) baseline.push_back(ns);
+            else ns -= baseline[k];
+            bench::row(std::cout, block_names[b], n, ns, double(bytes) / rounds);
+        }
+    return 0;
+}
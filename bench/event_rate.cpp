@@ -0,0 +1,85 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file event_rate.cpp
+ * @brief Measures the rate of round events processed by the simulator against the number of devices.
+ *
+ * Devices follow the round schedule of the spreading collection case study (Weibull-distributed
+ * intervals with mean 1 and deviation 0.1) and run an empty program, without any connection,
+ * so that the time measured is dominated by the ordering and dispatch of events.
+ */
+
+#include <sstream>
+
+#include "lib/fcpp.hpp"
+#include "bench/benchmark.hpp"
+
+//! @brief The final simulation time.
+constexpr size_t end_time = 10;
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Namespace containing the libraries of coordination routines.
+namespace coordination {
+
+
+namespace tags {
+    //! @brief The number of devices.
+    struct devices {};
+}
+
+
+//! @brief Main function (empty).
+MAIN() {}
+//! @brief Exports for the main function (none).
+FUN_EXPORT main_t = common::export_list<>;
+
+
+}
+
+
+}
+
+using namespace fcpp;
+using namespace component::tags;
+using namespace coordination::tags;
+
+//! @brief The round schedule of the spreading collection case study (with tvar equal to 10).
+using round_s = sequence::periodic<
+    distribution::interval_n<times_t, 0, 1>,
+    distribution::weibull_n<times_t, 10, 1, 10>,
+    distribution::constant_n<times_t, end_time+2>
+>;
+
+//! @brief The sequence of node generation events (all devices generated at time 0).
+using spawn_s = sequence::multiple<
+    distribution::constant_i<size_t, devices>,
+    distribution::constant_n<double, 0>
+>;
+
+//! @brief The simulation options.
+DECLARE_OPTIONS(opt,
+    parallel<false>,
+    synchronised<false>,
+    program<coordination::main>,
+    exports<coordination::main_t>,
+    round_schedule<round_s>,
+    spawn_schedule<spawn_s>,
+    connector<connect::fixed<0>>
+);
+
+int main() {
+    //! @brief The network object type (batch simulator with given options).
+    using net_t = component::batch_simulator<opt>::net;
+    std::stringstream log;
+    bench::row(std::cout, "devices", "events/s");
+    for (size_t n = 1000; n <= 1000000; n *= 10) {
+        double t = bench::timed_run<net_t>(common::make_tagged_tuple<devices, output>(n, &log));
+        bench::row(std::cout, n, n * end_time / t);
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file log_overhead.cpp
+ * @brief Measures the share of runtime spent computing log aggregators in the spreading collection case study.
+ *
+ * The case study is run with its usual log schedule and aggregators, and without any log event,
+ * for increasing numbers of devices (at constant density), printing both runtimes and the share
+ * of the first due to logging.
+ */
+
+#include <cmath>
+#include <sstream>
+#include <type_traits>
+
+#define FCPP_HEADLESS
+
+#include "lib/spreading_collection.hpp"
+#include "bench/benchmark.hpp"
+
+using namespace fcpp;
+using namespace option;
+
+//! @brief The simulation options, with or without log events.
+template <bool logged>
+DECLARE_OPTIONS(opt,
+    parallel<false>,
+    synchronised<false>,
+    export_split<true>,
+    message_size<true>,
+    program<coordination::main>,
+    exports<coordination::main_t>,
+    round_schedule<round_s>,
+    log_schedule<std::conditional_t<logged, log_s, sequence::never>>,
+    spawn_schedule<spawn_s>,
+    store_t,
+    render_t,
+    aggregator_t,
+    init<
+        x,      rectangle_d,
+        side,   side_d,
+        speed,  speed_d
+    >,
+    extra_info<
+        tvar,   double,
+        dens,   double,
+        hops,   double,
+        speed,  double
+    >,
+    dimension<dim>,
+    connector<connect::fixed<comm, 1, dim>>
+);
+
+int main() {
+    std::stringstream log;
+    bench::row(std::cout, "devices", "logged (s)", "unlogged (s)", "log share");
+    for (size_t n = 1000; n <= 10000; n *= 10) {
+        // side of the area keeping 10 neighbours per device on average
+        double s = std::sqrt(n * 3.141592653589793 * comm * comm / 10);
+        auto init_v = common::make_tagged_tuple<devices, option::side, option::speed, tvar, dens, hops, output>(n, s, 10, 10, 10, 10, &log);
+        double t = bench::timed_run<component::batch_simulator<opt<true>>::net>(init_v);
+        double u = bench::timed_run<component::batch_simulator<opt<false>>::net>(init_v);
+        bench::row(std::cout, n, t, u, (t - u) / t);
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file message_dispatch_matrix.cpp
+ * @brief Runs the message dispatch case study under every combination of execution options.
+ */
+
+#include <sstream>
+
+#define FCPP_HEADLESS
+
+#include "lib/message_dispatch.hpp"
+#include "bench/option_matrix.hpp"
+
+using namespace fcpp;
+using namespace component::tags;
+using namespace coordination::tags;
+
+//! @brief The final simulation time (messages are generated between times 10 and 50).
+constexpr size_t end = 100;
+
+//! @brief The simulation options, with the given combination of execution options (as in message_dispatch, without rendering).
+template <int O>
+DECLARE_OPTIONS(opt,
+    program<coordination::main>,
+    exports<coordination::main_t>,
+    round_schedule<sequence::periodic_n<1, 0, 1, end>>,
+    spawn_schedule<sequence::multiple_n<devices, 0>>,
+    tuple_store<
+        speed,              double,
+        routing,            int,
+        pruning,            int,
+        traffic_seed,       uint32_t,
+        home,               vec<3>,
+        home_time,          times_t,
+        border_streaks,     coordination::table_t,
+        max_msg,            size_t,
+        tot_msg,            size_t,
+        max_proc,           size_t,
+        tot_proc,           size_t,
+        first_delivery,     times_t,
+        sent_count,         size_t,
+        delivery_count,     size_t,
+        repeat_count,       size_t,
+        center_dist,        double
+    >,
+    init<
+        x,                  distribution::rect_n<1, 0, 0, 0, side, side, height>,
+        speed,              distribution::constant_n<double, 1>,
+        pruning,            distribution::constant_n<int, 1>,
+        traffic_seed,       distribution::constant_i<uint32_t, seed>
+    >,
+    dimension<3>,
+    connector<connect::fixed<comm, 1, 3>>,
+    message_size<true>,
+    option::flags<O>
+);
+
+//! @brief The component type, with the given combination of execution options.
+template <int O>
+using comp_t = component::batch_simulator<opt<O>>;
+
+int main() {
+    std::stringstream log;
+    auto init_v = common::make_tagged_tuple<seed, output>(0, &log);
+    bench::matrix<comp_t, tot_msg>(std::cout, init_v, devices, devices * end);
+    return 0;
+}
@@ -0,0 +1,97 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file message_dispatch_routing.cpp
+ * @brief Compares tree and geographic routing in the message dispatch case study, with and without pruning of processes.
+ *
+ * For every routing mode, pruning setting, device speed (from the default of message_dispatch
+ * to those of the other case studies) and random seed, the number of messages sent and
+ * delivered, the average delivery delay, the maximum and average message size, the
+ * average number of processes per round and the runtime per round are printed.
+ */
+
+#include <sstream>
+
+#define FCPP_HEADLESS
+
+#include "lib/message_dispatch.hpp"
+#include "bench/benchmark.hpp"
+
+using namespace fcpp;
+using namespace component::tags;
+using namespace coordination::tags;
+
+//! @brief The final simulation time (messages are generated between times 10 and 50).
+constexpr size_t end = 200;
+
+//! @brief Names of the routing modes.
+constexpr char const* routing_names[] = {"tree", "geographic"};
+
+//! @brief The simulation options (as in message_dispatch, without rendering).
+DECLARE_OPTIONS(opt,
+    parallel<false>,
+    synchronised<false>,
+    program<coordination::main>,
+    exports<coordination::main_t>,
+    round_schedule<sequence::periodic<
+        distribution::interval_n<times_t, 0, 1>,
+        distribution::weibull_n<times_t, 10, 1, 10>,
+        distribution::constant_n<times_t, end+2>
+    >>,
+    spawn_schedule<sequence::multiple_n<devices, 0>>,
+    tuple_store<
+        speed,              double,
+        routing,            int,
+        pruning,            int,
+        traffic_seed,       uint32_t,
+        home,               vec<3>,
+        home_time,          times_t,
+        border_streaks,     coordination::table_t,
+        max_msg,            size_t,
+        tot_msg,            size_t,
+        max_proc,           size_t,
+        tot_proc,           size_t,
+        first_delivery,     times_t,
+        sent_count,         size_t,
+        delivery_count,     size_t,
+        repeat_count,       size_t,
+        center_dist,        double
+    >,
+    init<
+        x,                  distribution::rect_n<1, 0, 0, 0, side, side, height>,
+        speed,              distribution::constant_i<double, speed>,
+        routing,            distribution::constant_i<int, routing>,
+        pruning,            distribution::constant_i<int, pruning>,
+        traffic_seed,       distribution::constant_i<uint32_t, seed>
+    >,
+    dimension<3>,
+    connector<connect::fixed<comm, 1, 3>>,
+    message_size<true>
+);
+
+int main() {
+    //! @brief The network object type (batch simulator with given options).
+    using net_t = component::batch_simulator<opt>::net;
+    std::stringstream log;
+    bench::row(std::cout, "routing", "pruning", "speed", "seed", "sent", "delivered", "avg delay", "max msg", "bytes/round", "procs/round", "ns/round");
+    for (int r = 0; r < 2; ++r)
+        for (int p = 0; p < 2; ++p)
+            for (double v : {1, 10, 30})
+                for (int s = 0; s < 5; ++s) {
+                    size_t sent = 0, delivered = 0, msg = 0, bytes = 0, procs = 0;
+                    double delay = 0;
+                    double t = bench::timed_run<net_t>(common::make_tagged_tuple<seed, routing, pruning, speed, output>(s, r, p, v, &log), [&](net_t& network){
+                        for (size_t i = 0; i < devices; ++i) {
+                            auto& n = network.node_at(i);
+                            sent += n.storage(sent_count{});
+                            delivered += n.storage(delivery_count{});
+                            delay += n.storage(first_delivery{});
+                            msg = std::max(msg, n.storage(max_msg{}));
+                            bytes += n.storage(tot_msg{});
+                            procs += n.storage(tot_proc{});
+                        }
+                    });
+                    bench::row(std::cout, routing_names[r], p, v, s, sent, delivered, delay / delivered, msg, double(bytes) / (devices * end), double(procs) / (devices * end), t * 1e9 / (devices * end));
+                }
+    return 0;
+}
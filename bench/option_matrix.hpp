@@ -0,0 +1,68 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file option_matrix.hpp
+ * @brief Runs a workload under all 32 combinations of the boolean execution options, printing a table of results.
+ *
+ * Every combination is run in a separate process, and reports the throughput (rounds
+ * per second), the peak memory (MB) and the average message size (bytes per round).
+ */
+
+#ifndef FCPP_OPTION_MATRIX_H_
+#define FCPP_OPTION_MATRIX_H_
+
+#include <utility>
+
+#include "lib/fcpp.hpp"
+#include "lib/execution_flags.hpp"
+#include "bench/benchmark.hpp"
+
+
+//! @brief Namespace containing benchmarking helpers.
+namespace bench {
+
+
+//! @brief Namespace for implementation details.
+namespace details {
+    //! @brief Runs the workload under a single combination of options.
+    template <int O, template <int> class C, typename M, typename T>
+    void matrix_row(std::ostream& o, T const& init, size_t devices, size_t rounds) {
+        using net_t = typename C<O>::net;
+        isolated([&](){
+            size_t bytes = 0;
+            double t = timed_run<net_t>(init, [&](net_t& network){
+                for (size_t i = 0; i < devices; ++i)
+                    bytes += network.node_at(i).storage(M{});
+            });
+            row(o, O & 1, (O >> 1) & 1, (O >> 2) & 1, (O >> 3) & 1, (O >> 4) & 1, rounds / t, peak_memory(), double(bytes) / rounds);
+        });
+    }
+
+    //! @brief Runs the workload under every combination of options.
+    template <template <int> class C, typename M, typename T, int... Os>
+    void matrix(std::ostream& o, T const& init, size_t devices, size_t rounds, std::integer_sequence<int, Os...>) {
+        using expander = int[];
+        (void)expander{0, (matrix_row<Os, C, M>(o, init, devices, rounds), 0)...};
+    }
+}
+
+
+/**
+ * @brief Runs a workload under every combination of the boolean execution options.
+ *
+ * @param C Template of the component type, given the combination of options (to be combined with `option::flags`).
+ * @param M Storage tag accumulating the message size exchanged by nodes.
+ * @param init Initialisation values of the network.
+ * @param devices The number of devices in the network (with identifiers from zero).
+ * @param rounds The expected total number of rounds.
+ */
+template <template <int> class C, typename M, typename T>
+void matrix(std::ostream& o, T const& init, size_t devices, size_t rounds) {
+    row(o, "pointer", "split", "drop", "parallel", "sync", "rounds/s", "peak MB", "bytes/round");
+    details::matrix<C, M>(o, init, devices, rounds, std::make_integer_sequence<int, 32>{});
+}
+
+
+}
+
+#endif // FCPP_OPTION_MATRIX_H_
@@ -0,0 +1,121 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file round_allocations.cpp
+ * @brief Measures heap allocations and latency per round in the message dispatch case study.
+ *
+ * The case study is run with 300 and 3000 devices (in areas of proportional size), printing
+ * the number of heap allocations per round and the average time per round. The program itself
+ * keeps no per-round temporaries on the heap (active processes are only counted): the remaining
+ * allocations are performed by the FCPP library (fields and exports) or are kept across rounds
+ * (the sets and maps computed by `sp_collection` and `spawn`).
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+
+#define FCPP_HEADLESS
+
+#include "lib/message_dispatch.hpp"
+#include "bench/benchmark.hpp"
+
+//! @brief The number of heap allocations performed.
+std::atomic<size_t> allocations{0};
+
+//! @brief Counting replacement of the global allocation function.
+void* operator new(size_t n) {
+    ++allocations;
+    if (void* p = std::malloc(n)) return p;
+    throw std::bad_alloc();
+}
+
+//! @brief Replacement of the global deallocation function.
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+//! @brief Replacement of the global sized deallocation function.
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+using namespace fcpp;
+using namespace component::tags;
+using namespace coordination::tags;
+
+//! @brief The final simulation time (messages are generated between times 10 and 50).
+constexpr size_t end = 60;
+
+//! @brief Tags for the scale of the benchmark.
+//! @{
+struct count {};
+struct area {};
+//! @}
+
+//! @brief The sequence of node generation events (all devices generated at time 0).
+using spawn_s = sequence::multiple<
+    distribution::constant_i<size_t, count>,
+    distribution::constant_n<double, 0>
+>;
+
+//! @brief The distribution of initial node positions (random in a square of given side).
+using rectangle_d = distribution::rect<
+    distribution::constant_n<double, 0>,
+    distribution::constant_n<double, 0>,
+    distribution::constant_n<double, 0>,
+    distribution::constant_i<double, area>,
+    distribution::constant_i<double, area>,
+    distribution::constant_n<double, height>
+>;
+
+//! @brief The simulation options (as in message_dispatch, without rendering).
+DECLARE_OPTIONS(opt,
+    parallel<false>,
+    synchronised<false>,
+    program<coordination::main>,
+    exports<coordination::main_t>,
+    round_schedule<sequence::periodic_n<1, 0, 1, end>>,
+    spawn_schedule<spawn_s>,
+    tuple_store<
+        speed,              double,
+        routing,            int,
+        pruning,            int,
+        traffic_seed,       uint32_t,
+        home,               vec<3>,
+        home_time,          times_t,
+        border_streaks,     coordination::table_t,
+        max_msg,            size_t,
+        tot_msg,            size_t,
+        max_proc,           size_t,
+        tot_proc,           size_t,
+        first_delivery,     times_t,
+        sent_count,         size_t,
+        delivery_count,     size_t,
+        repeat_count,       size_t,
+        center_dist,        double
+    >,
+    init<
+        x,                  rectangle_d,
+        speed,              distribution::constant_n<double, 1>,
+        pruning,            distribution::constant_n<int, 1>,
+        traffic_seed,       distribution::constant_i<uint32_t, seed>
+    >,
+    dimension<3>,
+    connector<connect::fixed<comm, 1, 3>>,
+    message_size<true>
+);
+
+int main() {
+    //! @brief The network object type (batch simulator with given options).
+    using net_t = component::batch_simulator<opt>::net;
+    std::stringstream log;
+    bench::row(std::cout, "devices", "allocs/round", "ns/round");
+    for (size_t n : {300, 3000}) {
+        size_t before = allocations;
+        double t = bench::timed_run<net_t>(common::make_tagged_tuple<seed, count, area, output>(0, n, discrete_sqrt(n * 3000), &log));
+        bench::row(std::cout, n, double(allocations - before) / (n * end), t * 1e9 / (n * end));
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file spreading_collection_matrix.cpp
+ * @brief Runs the spreading collection case study under every combination of execution options.
+ */
+
+#include <sstream>
+
+#define FCPP_HEADLESS
+
+#include "lib/spreading_collection.hpp"
+#include "bench/option_matrix.hpp"
+
+using namespace fcpp;
+
+//! @brief Number of devices.
+constexpr size_t devices = 1000;
+
+//! @brief The simulation options, with the given combination of execution options.
+template <int O>
+DECLARE_OPTIONS(opt,
+    option::base,
+    option::message_size<true>,
+    option::flags<O>
+);
+
+//! @brief The component type, with the given combination of execution options.
+template <int O>
+using comp_t = component::batch_simulator<opt<O>>;
+
+int main() {
+    std::stringstream log;
+    //! @brief The initialisation values (same as spreading_collection_run).
+    auto init_v = common::make_tagged_tuple<option::speed, option::side, option::devices, option::tvar, option::output>(
+        25,
+        2000,
+        devices,
+        10,
+        &log
+    );
+    bench::matrix<comp_t, option::tot_msg>(std::cout, init_v, devices, devices * end_time);
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file startup.cpp
+ * @brief Measures the time to first round of the spreading collection case study against the number of devices.
+ *
+ * For every number of devices (from 10^3 to 10^6, at constant density), the time needed
+ * to construct the network object, to spawn and initialise every node (the spawn events,
+ * all at time 0) and to run the first round of every node (at time 1) are printed.
+ * Nodes are spawned by the network while running, so the phases are separated by
+ * processing events one at a time up to the given times.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <sstream>
+
+#define FCPP_HEADLESS
+
+#include "lib/spreading_collection.hpp"
+#include "bench/benchmark.hpp"
+
+using namespace fcpp;
+using namespace option;
+
+//! @brief The time of the first (and only) round of every device (spawned at time 0).
+constexpr size_t round_time = 1;
+
+//! @brief The simulation options, with a single round for every device.
+DECLARE_OPTIONS(opt,
+    parallel<false>,
+    synchronised<false>,
+    program<coordination::main>,
+    exports<coordination::main_t>,
+    round_schedule<sequence::list<distribution::constant_n<times_t, round_time>>>,
+    spawn_schedule<spawn_s>,
+    store_t,
+    render_t,
+    init<
+        x,      rectangle_d,
+        side,   side_d,
+        speed,  speed_d
+    >,
+    dimension<dim>,
+    connector<connect::fixed<comm, 1, dim>>,
+    message_size<true>
+);
+
+//! @brief Processes the events of a network up to a given time (included).
+template <typename N>
+void run_until(N& network, times_t t) {
+    while (network.next() <= t) network.update();
+}
+
+//! @brief Seconds elapsed between two time points.
+template <typename T>
+double seconds(T const& start, T const& end) {
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int main() {
+    //! @brief The network object type (batch simulator with given options).
+    using net_t = component::batch_simulator<opt>::net;
+    std::stringstream log;
+    bench::row(std::cout, "devices", "construct (s)", "spawn (s)", "first round (s)");
+    for (size_t n = 1000; n <= 1000000; n *= 10) {
+        // side of the area keeping 10 neighbours per device on average
+        double s = std::sqrt(n * 3.141592653589793 * comm * comm / 10);
+        auto start = std::chrono::high_resolution_clock::now();
+        net_t network{common::make_tagged_tuple<devices, option::side, option::speed, tvar, output>(n, s, 0, 0, &log)};
+        auto built = std::chrono::high_resolution_clock::now();
+        run_until(network, 0);
+        auto spawned = std::chrono::high_resolution_clock::now();
+        run_until(network, round_time);
+        auto end = std::chrono::high_resolution_clock::now();
+        bench::row(std::cout, n, seconds(start, built), seconds(built, spawned), seconds(spawned, end));
+    }
+    return 0;
+}
@@ -12,6 +12,9 @@
 #include "lib/coordination.hpp"
 #include "lib/data.hpp"
 
+#include "lib/compression.hpp"
+#include "lib/quiescence.hpp"
+
 
 /**
  * @brief Namespace containing all the objects in the FCPP library.
@@ -46,6 +49,7 @@ constexpr size_t height = 100;
 constexpr float hue_scale = 360.0f/(side+height);
 
 
+
 //! @brief Namespace containing the libraries of coordination routines.
 namespace coordination {
 
@@ -68,6 +72,12 @@ namespace tags {
 
 //! @brief Shape of the current node.
     struct node_shape {};
+
+    //! @brief The maximum message size ever exchanged by the node.
+    struct max_msg {};
+
+    //! @brief The total message size ever exchanged by the node.
+    struct tot_msg {};
 }
 
 
@@ -77,7 +87,9 @@ FUN bool channel(ARGS, bool source, bool dest, double width) { CODE
     double dd = bis_distance(CALL, dest, 1, 100);
     node.storage(tags::source_distance{}) = ds;
     node.storage(tags::dest_distance{}) = dd;
-    bool c = ds + dd < broadcast(CALL, ds, dd) + width;
+    double precision = node.storage(tags::export_precision{});
+    double sd = precision > 0 ? compressed_broadcast(CALL, ds, dd, precision, 10) : broadcast(CALL, ds, dd);
+    bool c = ds + dd < sd + width;
     c = c or source or dest;
     node.storage(tags::in_channel{}) = c;
     node.storage(tags::distance_c{}) = c ? color::hsva(min(ds,dd)*hue_scale, 1, 1) : color();
@@ -85,7 +97,7 @@ FUN bool channel(ARGS, bool source, bool dest, double width) { CODE
     return c;
 }
 //! @brief Exports for the channel function.
-FUN_EXPORT channel_t = common::export_list<bis_distance_t, broadcast_t<double, double>>;
+FUN_EXPORT channel_t = common::export_list<bis_distance_t, broadcast_t<double, double>, compressed_broadcast_t>;
 
 //! @brief Main function.
 MAIN() {
@@ -96,9 +108,15 @@ MAIN() {
     bool is_dst = node.uid == dst_id;
     channel(CALL, is_src, is_dst, 20);
     node.storage(tags::size{}) = is_src or is_dst ? 30 : 10;
+    // elide rounds while nothing changes (after 3 quiet rounds, at most 1 round out of 2)
+    double change = max(variation(CALL, node.storage(tags::source_distance{})), variation(CALL, node.storage(tags::dest_distance{})));
+    quiescence(CALL, change, 3, 1);
+    // msg stats
+    node.storage(tags::max_msg{}) = max(node.storage(tags::max_msg{}), node.msg_size());
+    node.storage(tags::tot_msg{}) += node.msg_size();
 }
 //! @brief Exports for the main function.
-FUN_EXPORT main_t = common::export_list<rectangle_walk_t<3>, channel_t>;
+FUN_EXPORT main_t = common::export_list<rectangle_walk_t<3>, channel_t, variation_t, quiescence_t>;
 
 
 }
@@ -8,9 +8,9 @@
 #ifndef FCPP_COLLECTION_COMPARE_H_
 #define FCPP_COLLECTION_COMPARE_H_
 
-#include "lib/beautify.hpp"
-#include "lib/coordination.hpp"
-#include "lib/data.hpp"
+#include "lib/fcpp.hpp"
+
+#include "lib/compression.hpp"
 
 
 /**
@@ -19,14 +19,39 @@
 namespace fcpp {
 
 
+//! @brief Value of the algorithm tag requiring every distance algorithm to be evaluated in the same run.
+constexpr int all_algorithms = 3;
+
+//! @brief Algorithm whose outputs are also stored as plain outputs in the all_algorithms mode (BIS).
+constexpr int reference_algorithm = 1;
+
+
 //! @brief Namespace containing the libraries of coordination routines.
 namespace coordination {
 
 
 namespace tags {
-    //! @brief Desired distance algorithm.
+    //! @brief Desired distance algorithm (0 = ABF, 1 = BIS, 2 = FLEX, 3 = all of them).
     struct algorithm {};
 
+    //! @brief Whether collections exchange distances as fixed-point values (`fixed_distance`) instead of doubles.
+    struct fixed_distances {};
+
+    //! @brief The total message size ever exchanged by the node.
+    struct tot_msg {};
+
+    //! @brief Length of the deployment strip.
+    struct side {};
+
+    //! @brief Movement speed of devices.
+    struct speed {};
+
+    //! @brief Number of devices (as simulation parameter).
+    struct devices {};
+
+    //! @brief Variance of round timing, in percentage (as simulation parameter).
+    struct tvar {};
+
     //! @brief Output values.
     //! @{
     struct spc_sum {};
@@ -38,9 +63,33 @@ namespace tags {
     struct wmpc_max {};
     struct ideal_max {};
     //! @}
+
+    //! @brief Output value computed on the distances of a given algorithm.
+    template <typename T, int a>
+    struct by_algorithm {};
 }
 
 
+//! @brief Output tags of the case studies, as they are.
+struct plain_outputs {
+    //! @brief The tag used for a given output.
+    template <typename T>
+    using tag = T;
+};
+
+//! @brief Output tags of the case studies, when computed on the distances of a given algorithm.
+template <int a>
+struct algorithm_outputs {
+    //! @brief The tag used for a given output.
+    template <typename T>
+    using tag = tags::by_algorithm<T, a>;
+};
+
+//! @brief The tag used for an output of a given kind.
+template <typename O, typename T>
+using output_tag = typename O::template tag<T>;
+
+
 //! @brief Computes the distance from a source through adaptive bellmann-ford with old+nbr.
 FUN double generic_distance(ARGS, int algorithm, bool source) { CODE
     if (algorithm == 0) return abf_distance(CALL, source);
@@ -51,8 +100,9 @@ FUN double generic_distance(ARGS, int algorithm, bool source) { CODE
 //! @brief Exports for the generic_distance function.
 FUN_EXPORT generic_distance_t = common::export_list<abf_distance_t, bis_distance_t, flex_distance_t>;
 
-//! @brief Device counting case study.
-FUN void device_counting(ARGS, bool is_source, double dist) { CODE
+//! @brief Device counting case study, storing outputs of kind O.
+template <typename O, typename node_t, typename P>
+void device_counting(ARGS, bool is_source, P const& dist) { CODE
     auto adder = [](double x, double y) {
         return x+y;
     };
@@ -65,16 +115,18 @@ FUN void device_counting(ARGS, bool is_source, double dist) { CODE
     double spc = sp_collection(CALL, dist, 1.0, 0.0, adder);
     double mpc = mp_collection(CALL, dist, 1.0, 0.0, adder, divider);
     double wmpc = wmp_collection(CALL, dist, 100.0, 1.0, adder, multiplier);
-    node.storage(tags::spc_sum{}) = is_source ? spc : 0;
-    node.storage(tags::mpc_sum{}) = is_source ? mpc : 0;
-    node.storage(tags::wmpc_sum{}) = is_source ? wmpc : 0;
+    node.storage(output_tag<O, tags::spc_sum>{}) = is_source ? spc : 0;
+    node.storage(output_tag<O, tags::mpc_sum>{}) = is_source ? mpc : 0;
+    node.storage(output_tag<O, tags::wmpc_sum>{}) = is_source ? wmpc : 0;
     node.storage(tags::ideal_sum{}) = 1.0;
 }
 //! @brief Exports for the device_counting function.
-FUN_EXPORT device_counting_t = common::export_list<sp_collection_t<double, double>, mp_collection_t<double, double>, wmp_collection_t<double>>;
+template <typename P>
+FUN_EXPORT device_counting_t = common::export_list<sp_collection_t<P, double>, mp_collection_t<P, double>, wmp_collection_t<double>>;
 
-//! @brief Progress tracking case study.
-FUN void progress_tracking(ARGS, bool is_source, device_t source_id, double dist) { CODE
+//! @brief Progress tracking case study, storing outputs of kind O.
+template <typename O, typename node_t, typename P>
+void progress_tracking(ARGS, bool is_source, device_t source_id, P const& dist) { CODE
     vec<2> source_pos = node.position();
     if (node.net.node_count(source_id))
         source_pos = node.net.node_at(source_id).position(node.current_time());
@@ -93,28 +145,142 @@ FUN void progress_tracking(ARGS, bool is_source, device_t source_id, double dist
     double spc = sp_collection(CALL, dist, value, 0.0, adder);
     double mpc = mp_collection(CALL, dist, value, 0.0, adder, divider);
     double wmpc = wmp_collection(CALL, dist, 100.0, value, adder, multiplier);
-    node.storage(tags::spc_max{}) = is_source ? spc : 0;
-    node.storage(tags::mpc_max{}) = is_source ? mpc : 0;
-    node.storage(tags::wmpc_max{}) = is_source ? wmpc : 0;
+    node.storage(output_tag<O, tags::spc_max>{}) = is_source ? spc : 0;
+    node.storage(output_tag<O, tags::mpc_max>{}) = is_source ? mpc : 0;
+    node.storage(output_tag<O, tags::wmpc_max>{}) = is_source ? wmpc : 0;
     node.storage(tags::ideal_max{}) = value;
 }
 //! @brief Exports for the progress_tracking function.
-FUN_EXPORT progress_tracking_t = common::export_list<sp_collection_t<double, double>, mp_collection_t<double, double>, wmp_collection_t<double>>;
+template <typename P>
+FUN_EXPORT progress_tracking_t = common::export_list<sp_collection_t<P, double>, mp_collection_t<P, double>, wmp_collection_t<double>>;
+
+//! @brief Runs both case studies on given distances, storing outputs of kind O.
+template <typename O, typename node_t, typename P>
+void case_studies(ARGS, bool is_source, device_t source_id, P const& dist) { CODE
+    device_counting<O>(CALL, is_source, dist);
+    progress_tracking<O>(CALL, is_source, source_id, dist);
+}
+//! @brief Exports for the case_studies function.
+template <typename P>
+FUN_EXPORT case_studies_t = common::export_list<device_counting_t<P>, progress_tracking_t<P>>;
+
+//! @brief Runs both case studies, exchanging distances as fixed-point values if requested, storing outputs of kind O.
+template <typename O, typename node_t>
+void case_studies(ARGS, bool is_source, device_t source_id, double dist, bool fixed) { CODE
+    if (fixed) case_studies<O>(CALL, is_source, source_id, fixed_distance(dist));
+    else case_studies<O>(CALL, is_source, source_id, dist);
+}
+
+//! @brief Copies the outputs of both case studies from outputs of kind `O` to outputs of kind `P`.
+template <typename O, typename P, typename node_t>
+void copy_outputs(node_t& node) {
+    node.storage(output_tag<P, tags::spc_sum>{})  = node.storage(output_tag<O, tags::spc_sum>{});
+    node.storage(output_tag<P, tags::mpc_sum>{})  = node.storage(output_tag<O, tags::mpc_sum>{});
+    node.storage(output_tag<P, tags::wmpc_sum>{}) = node.storage(output_tag<O, tags::wmpc_sum>{});
+    node.storage(output_tag<P, tags::spc_max>{})  = node.storage(output_tag<O, tags::spc_max>{});
+    node.storage(output_tag<P, tags::mpc_max>{})  = node.storage(output_tag<O, tags::mpc_max>{});
+    node.storage(output_tag<P, tags::wmpc_max>{}) = node.storage(output_tag<O, tags::wmpc_max>{});
+}
+
+//! @brief Runs both case studies on the distances computed by algorithm `a`, storing outputs by algorithm and returning the distance.
+template <int a, typename node_t>
+double algorithm_case_studies(ARGS, bool is_source, device_t source_id, bool fixed) { CODE
+    double dist = generic_distance(CALL, a, is_source);
+    case_studies<algorithm_outputs<a>>(CALL, is_source, source_id, dist, fixed);
+    return dist;
+}
+//! @brief Exports for the algorithm_case_studies function.
+FUN_EXPORT algorithm_case_studies_t = common::export_list<generic_distance_t, case_studies_t<double>, case_studies_t<fixed_distance>>;
 
 //! @brief Main function.
 MAIN() {
-    rectangle_walk(CALL, make_vec(0,0), make_vec(2000,200), 30.5, 1);
+    rectangle_walk(CALL, make_vec(0,0), make_vec(node.storage(tags::side{}), 200), node.storage(tags::speed{}), 1);
     
     device_t source_id = node.current_time() < 250 ? 0 : 1;
     bool is_source = node.uid == source_id;
     int dist_algo = node.storage(tags::algorithm{});
-    double dist = generic_distance(CALL, dist_algo, is_source);
-    
-    device_counting(CALL, is_source, dist);
-    progress_tracking(CALL, is_source, source_id, dist);
+    bool fixed = node.storage(tags::fixed_distances{});
+    if (dist_algo == all_algorithms) {
+        // same trajectories and rounds for every algorithm
+        algorithm_case_studies<0>(CALL, is_source, source_id, fixed);
+        algorithm_case_studies<1>(CALL, is_source, source_id, fixed);
+        algorithm_case_studies<2>(CALL, is_source, source_id, fixed);
+        // the plain outputs are those of the reference algorithm
+        copy_outputs<algorithm_outputs<reference_algorithm>, plain_outputs>(node);
+    } else {
+        double dist = generic_distance(CALL, dist_algo, is_source);
+        case_studies<plain_outputs>(CALL, is_source, source_id, dist, fixed);
+    }
+    // message size statistics
+    node.storage(tags::tot_msg{}) += node.msg_size();
 }
 //! @brief Exports for the main function.
-FUN_EXPORT main_t = common::export_list<rectangle_walk_t<2>, generic_distance_t, device_counting_t, progress_tracking_t>;
+FUN_EXPORT main_t = common::export_list<rectangle_walk_t<2>, generic_distance_t, case_studies_t<double>, case_studies_t<fixed_distance>, algorithm_case_studies_t>;
+
+
+}
+
+
+//! @brief Namespace for component options.
+namespace option {
+
+
+//! @brief Import tags to be used for component options.
+using namespace component::tags;
+//! @brief Import tags used by aggregate functions.
+using namespace coordination::tags;
+
+
+//! @brief Storage and aggregators for the device counting outputs of a given kind.
+template <typename O>
+DECLARE_OPTIONS(sum_outputs,
+    tuple_store<
+        coordination::output_tag<O, spc_sum>,   double,
+        coordination::output_tag<O, mpc_sum>,   double,
+        coordination::output_tag<O, wmpc_sum>,  double
+    >,
+    aggregators<
+        coordination::output_tag<O, spc_sum>,   aggregator::sum<double>,
+        coordination::output_tag<O, mpc_sum>,   aggregator::sum<double>,
+        coordination::output_tag<O, wmpc_sum>,  aggregator::sum<double>
+    >
+);
+
+//! @brief Storage and aggregators for the progress tracking outputs of a given kind.
+template <typename O>
+DECLARE_OPTIONS(max_outputs,
+    tuple_store<
+        coordination::output_tag<O, spc_max>,   double,
+        coordination::output_tag<O, mpc_max>,   double,
+        coordination::output_tag<O, wmpc_max>,  double
+    >,
+    aggregators<
+        coordination::output_tag<O, spc_max>,   aggregator::max<double>,
+        coordination::output_tag<O, mpc_max>,   aggregator::max<double>,
+        coordination::output_tag<O, wmpc_max>,  aggregator::max<double>
+    >
+);
+
+//! @brief Storage and aggregators for the outputs of a given algorithm.
+template <int a>
+DECLARE_OPTIONS(algorithm_outputs,
+    sum_outputs<coordination::algorithm_outputs<a>>,
+    max_outputs<coordination::algorithm_outputs<a>>
+);
+
+//! @brief Storage and aggregators for the outputs besides the plain ones (by algorithm), and for the message size.
+DECLARE_OPTIONS(extra_outputs,
+    tuple_store<
+        fixed_distances,    int,
+        tot_msg,            size_t
+    >,
+    aggregators<
+        tot_msg,            aggregator::sum<size_t>
+    >,
+    algorithm_outputs<0>,
+    algorithm_outputs<1>,
+    algorithm_outputs<2>
+);
 
 
 }
@@ -0,0 +1,288 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file compression.hpp
+ * @brief Compressed exchange of real values, through quantisation and delta encoding.
+ *
+ * Values are quantised to a given precision, and exported as variable-length deltas
+ * against the latest key value, which is sent every few rounds. Since every delta
+ * refers to the key value and not to the previous round, receivers decode it
+ * regardless of how many rounds of the sender they missed.
+ * Exports of values are then typically 2-3 bytes long instead of 8. In order not to
+ * send the per-neighbour decoding state, this is best used together with `export_split<true>`.
+ * The samples enable compression through the `export_precision` storage tag.
+ *
+ * Alternatively, distances can be exchanged through the `fixed_distance` type, which
+ * is stored and exported in 2 bytes with a precision of 0.1 (up to 6553.4).
+ */
+
+#ifndef FCPP_COMPRESSION_H_
+#define FCPP_COMPRESSION_H_
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "lib/beautify.hpp"
+#include "lib/coordination.hpp"
+#include "lib/data.hpp"
+
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Quantised value representing unknown or non-finite values.
+constexpr int64_t quantised_inf = std::numeric_limits<int64_t>::max();
+
+//! @brief Quantises a value to the closest multiple of a given precision (`quantised_inf` for non-finite or huge values).
+inline int64_t quantise(double x, double precision) {
+    double q = std::round(x / precision);
+    return std::abs(q) < 1e18 ? int64_t(q) : quantised_inf;
+}
+
+//! @brief Converts a quantised value back to a real value.
+inline double dequantise(int64_t q, double precision) {
+    return q == quantised_inf ? std::numeric_limits<double>::infinity() : q * precision;
+}
+
+
+/**
+ * @brief Fixed-point real number, stored as an integer multiple of `num/den`.
+ *
+ * Values above the representable range are stored as infinity, values below are
+ * clamped to the minimum. Comparisons are exact, while any other operation is
+ * carried out on the `double` value the number implicitly converts to.
+ */
+template <typename I, intmax_t num, intmax_t den = 1>
+class fixed_point {
+  public:
+    //! @brief The integer value representing infinity.
+    static constexpr I inf = std::numeric_limits<I>::max();
+
+    //! @brief Empty constructor.
+    fixed_point() = default;
+
+    //! @brief Constructor from a real value.
+    explicit fixed_point(double x) {
+        double r = std::round(x * den / num);
+        if (not (r < inf)) m_raw = inf;
+        else if (r < std::numeric_limits<I>::min()) m_raw = std::numeric_limits<I>::min();
+        else m_raw = I(r);
+    }
+
+    //! @brief Conversion to a real value.
+    operator double() const {
+        return m_raw == inf ? std::numeric_limits<double>::infinity() : m_raw * double(num) / den;
+    }
+
+    //! @brief Equality operator.
+    bool operator==(fixed_point const& o) const {
+        return m_raw == o.m_raw;
+    }
+
+    //! @brief Inequality operator.
+    bool operator!=(fixed_point const& o) const {
+        return m_raw != o.m_raw;
+    }
+
+    //! @brief Less-than operator.
+    bool operator<(fixed_point const& o) const {
+        return m_raw < o.m_raw;
+    }
+
+    //! @brief Less-or-equal operator.
+    bool operator<=(fixed_point const& o) const {
+        return m_raw <= o.m_raw;
+    }
+
+    //! @brief Greater-than operator.
+    bool operator>(fixed_point const& o) const {
+        return m_raw > o.m_raw;
+    }
+
+    //! @brief Greater-or-equal operator.
+    bool operator>=(fixed_point const& o) const {
+        return m_raw >= o.m_raw;
+    }
+
+    //! @brief Serialises the content from/to a given input/output stream.
+    template <typename S>
+    S& serialize(S& s) {
+        return s & m_raw;
+    }
+
+    //! @brief Serialises the content from/to a given input/output stream (const overload).
+    template <typename S>
+    S& serialize(S& s) const {
+        return s << m_raw;
+    }
+
+  private:
+    //! @brief The integer representation.
+    I m_raw = 0;
+};
+
+//! @brief Distance type with 0.1 precision, exported in 2 bytes.
+using fixed_distance = fixed_point<uint16_t, 1, 10>;
+
+
+//! @brief Compact export of a quantised value, either as a key value or as a delta against the latest key value.
+struct delta_code {
+    //! @brief Sequence number of the key value of the sender (modulo 128).
+    uint8_t seq = 0;
+    //! @brief Whether the value is a key value (as opposed to a delta).
+    bool key = true;
+    //! @brief The key value or delta.
+    int64_t value = 0;
+
+    //! @brief Empty constructor.
+    delta_code() = default;
+
+    //! @brief Member constructor.
+    delta_code(uint8_t seq, bool key, int64_t value) : seq(seq), key(key), value(value) {}
+
+    //! @brief Equality operator.
+    bool operator==(delta_code const& c) const {
+        return seq == c.seq and key == c.key and value == c.value;
+    }
+
+    /**
+     * @brief Serialises the content from/to a given input/output stream.
+     *
+     * The content is a header byte followed by the value as a zig-zag varint. Every byte
+     * is computed from the current content before being passed to the stream, and the
+     * content is rebuilt from the bytes after, so that the same code reads and writes.
+     */
+    template <typename S>
+    S& serialize(S& s) {
+        uint8_t h = (seq << 1) | key;
+        s & h;
+        seq = h >> 1;
+        key = h & 1;
+        uint64_t z = (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+        uint64_t r = 0;
+        for (int i = 0; ; i += 7) {
+            uint8_t b = uint8_t((z >> i) & 127) | ((z >> i) >= 128 ? 128 : 0);
+            s & b;
+            r |= uint64_t(b & 127) << i;
+            if (b < 128) break;
+        }
+        value = int64_t(r >> 1) ^ -int64_t(r & 1);
+        return s;
+    }
+
+    //! @brief Serialises the content from/to a given input/output stream (const overload).
+    template <typename S>
+    S& serialize(S& s) const {
+        delta_code c = *this;
+        return c.serialize(s);
+    }
+};
+
+//! @brief Latest key value received from a neighbour, with its sequence number (-1 if none) and the latest decoded value.
+using delta_base = tuple<int64_t, int, int64_t>;
+
+
+//! @brief Namespace containing the libraries of coordination routines.
+namespace coordination {
+
+
+namespace tags {
+    //! @brief Precision of the values exchanged through compressed exports (zero, the default, disables compression).
+    struct export_precision {};
+}
+
+
+//! @brief Namespace for implementation details.
+namespace details {
+    //! @brief Decoding state of a neighbour never heard from.
+    const delta_base delta_none{quantised_inf, -1, quantised_inf};
+
+    //! @brief Updates the quantised values known for neighbours, given their latest codes (dropping the state of departed neighbours).
+    inline field<delta_base> delta_decode(field<delta_code> const& f, field<delta_base> const& b) {
+        field<delta_base> r = map_hood([](delta_code const& c, delta_base const& x) -> delta_base {
+            if (c.key) return delta_base(c.value, int(c.seq), c.value);
+            if (get<1>(x) == c.seq) return delta_base(get<0>(x), get<1>(x), get<0>(x) + c.value);
+            // missed the key value: the latest decoded value is kept until the next one
+            return x;
+        }, f, b);
+        // only the current neighbours (the domain of the codes) are kept
+        r = fcpp::details::align(std::move(r), fcpp::details::get_ids(f));
+        // new neighbours are decoded from scratch, not against the default of the field
+        fcpp::details::other(r) = delta_none;
+        return r;
+    }
+}
+
+
+/**
+ * @brief Compressed version of `nbr(CALL, init, op)` on real values.
+ *
+ * The function `op` receives the field of (dequantised) neighbour values, and returns
+ * the value to be exported, which is quantised to the given `precision` and sent as a
+ * delta against the latest key value. A key value is sent every `keyframe` rounds,
+ * and whenever a delta cannot be encoded. Neighbours missing a key value keep the
+ * value they last decoded until the next one, while neighbours that have never
+ * received a key value consider the value unknown (infinite).
+ *
+ * @return The field of neighbour values passed to `op`.
+ */
+GEN(F) field<double> delta_nbr(ARGS, double init, F&& op, double precision, int keyframe) { CODE
+    int r = old(CALL, 0, [](int r){
+        return r+1;
+    }) - 1;
+    field<double> v(init);
+    nbr(CALL, delta_code(0, true, quantise(init, precision)), [&](field<delta_code> f){
+        field<delta_base> b = old(CALL, field<delta_base>(details::delta_none), [&](field<delta_base> b){
+            return details::delta_decode(f, b);
+        });
+        v = map_hood([=](delta_base const& x){
+            return dequantise(get<2>(x), precision);
+        }, b);
+        int64_t q = quantise(op(v), precision);
+        delta_code c;
+        old(CALL, details::delta_none, [&](delta_base k){
+            bool key = r % keyframe == 0 or q == quantised_inf or get<0>(k) == quantised_inf;
+            if (key) k = delta_base(q, (get<1>(k) + 1) % 128, q);
+            c = delta_code(get<1>(k), key, key ? q : q - get<0>(k));
+            return k;
+        });
+        return c;
+    });
+    return v;
+}
+
+//! @brief Compressed version of `nbr(CALL, value)` on real values (see the general overload).
+FUN field<double> delta_nbr(ARGS, double value, double precision, int keyframe) { CODE
+    field<double> v = delta_nbr(CALL, value, [&](field<double> const&){
+        return value;
+    }, precision, keyframe);
+    return mod_self(CALL, v, value);
+}
+//! @brief Exports for the delta_nbr function.
+FUN_EXPORT delta_nbr_t = common::export_list<delta_code, int, delta_base, field<delta_base>>;
+
+//! @brief Broadcasts a value along a distance gradient, as `broadcast` but exchanging compressed values.
+FUN double compressed_broadcast(ARGS, double distance, double value, double precision, int keyframe) { CODE
+    field<double> d = delta_nbr(CALL, distance, precision, keyframe);
+    double result = value;
+    delta_nbr(CALL, value, [&](field<double> const& v){
+        result = get<1>(min_hood(CALL, make_tuple(d, v), make_tuple(distance, value)));
+        return result;
+    }, precision, keyframe);
+    return result;
+}
+//! @brief Exports for the compressed_broadcast function.
+FUN_EXPORT compressed_broadcast_t = common::export_list<delta_nbr_t>;
+
+
+}
+
+
+}
+
+#endif // FCPP_COMPRESSION_H_
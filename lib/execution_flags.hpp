@@ -0,0 +1,47 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file execution_flags.hpp
+ * @brief Combinations of the boolean execution options, encoded as bits of an integer.
+ *
+ * Bit 0 is `export_pointer`, bit 1 `export_split`, bit 2 `online_drop`, bit 3 `parallel`
+ * and bit 4 `synchronised`, as in the `MULTI_TEST` macro of the FCPP tests.
+ */
+
+#ifndef FCPP_EXECUTION_FLAGS_H_
+#define FCPP_EXECUTION_FLAGS_H_
+
+#include "lib/fcpp.hpp"
+
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Namespace for component options.
+namespace option {
+
+
+//! @brief Import tags to be used for component options.
+using namespace component::tags;
+
+
+//! @brief The boolean execution options, as bits of an integer.
+template <int O>
+DECLARE_OPTIONS(flags,
+    export_pointer<(O & 1) == 1>,
+    export_split<(O & 2) == 2>,
+    online_drop<(O & 4) == 4>,
+    parallel<(O & 8) == 8>,
+    synchronised<(O & 16) == 16>
+);
+
+
+}
+
+
+}
+
+#endif // FCPP_EXECUTION_FLAGS_H_
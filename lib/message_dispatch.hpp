@@ -3,6 +3,9 @@
 /**
  * @file message_dispatch.hpp
  * @brief Aggregate process dispatching point-to-point messages, avoiding to flood the network.
+ *
+ * Defining the `FCPP_HEADLESS` macro before including this header removes from nodes
+ * all data used only for rendering, for executions without a GUI.
  */
 
 #ifndef FCPP_MESSAGE_DISPATCH_H_
@@ -11,6 +14,8 @@
 #include "lib/beautify.hpp"
 #include "lib/coordination.hpp"
 #include "lib/data.hpp"
+#include "lib/philox.hpp"
+#include "lib/profiling.hpp"
 
 
 //! @brief Struct representing a message.
@@ -52,6 +57,34 @@ struct message {
     }
 };
 
+//! @brief Struct representing a message carrying the positions of its endpoints (for geographic routing).
+struct located_message : message {
+    //! @brief Sender position at creation.
+    fcpp::vec<3> source;
+    //! @brief Receiver address (its registered position).
+    fcpp::vec<3> target;
+    //! @brief Time at which the receiver address was registered.
+    fcpp::times_t located;
+
+    //! @brief Empty constructor.
+    located_message() = default;
+
+    //! @brief Member constructor.
+    located_message(fcpp::device_t from, fcpp::device_t to, fcpp::times_t time, fcpp::vec<3> source, fcpp::vec<3> target, fcpp::times_t located) : message(from, to, time), source(source), target(target), located(located) {}
+
+    //! @brief Serialises the content from/to a given input/output stream.
+    template <typename S>
+    S& serialize(S& s) {
+        return message::serialize(s) & source & target & located;
+    }
+
+    //! @brief Serialises the content from/to a given input/output stream (const overload).
+    template <typename S>
+    S& serialize(S& s) const {
+        return message::serialize(s) << source << target << located;
+    }
+};
+
 
 namespace std {
     //! @brief Hasher object for the message struct.
@@ -62,6 +95,15 @@ namespace std {
             return m.hash();
         }
     };
+
+    //! @brief Hasher object for the located message struct.
+    template <>
+    struct hash<located_message> {
+        //! @brief Produces an hash for a located message (positions are determined by the other fields).
+        size_t operator()(located_message const& m) const {
+            return m.hash();
+        }
+    };
 }
 
 
@@ -97,6 +139,18 @@ constexpr size_t height = 100;
 //! @brief Color hue scale.
 constexpr float hue_scale = 360.0f/(side+height);
 
+//! @brief Width of the elliptic channel followed by messages in geographic routing.
+constexpr double routing_width = comm;
+
+//! @brief Time after which a message process is terminated, whether delivered or not.
+constexpr times_t process_ttl = 100;
+
+//! @brief Period after which a node registers its current position as its address.
+constexpr times_t address_period = 10;
+
+//! @brief Number of consecutive rounds as border after which a node stops running a process.
+constexpr int border_rounds = 3;
+
 
 //! @brief Namespace containing the libraries of coordination routines.
 namespace coordination {
@@ -106,6 +160,24 @@ namespace tags {
     //! @brief The movement speed of devices.
     struct speed {};
 
+    //! @brief The routing mode (0 = along the spanning tree, 1 = geographic).
+    struct routing {};
+
+    //! @brief Whether expired processes are terminated and idle border nodes leave processes.
+    struct pruning {};
+
+    //! @brief Seed of the random generation of messages (to be initialised with the simulation seed).
+    struct traffic_seed {};
+
+    //! @brief Position of the node when it last registered its address, used by geographic routing.
+    struct home {};
+
+    //! @brief Time of the last registration of the address of the node.
+    struct home_time {};
+
+    //! @brief Consecutive rounds as border of the node in the processes it is pruning (meant only for the node itself).
+    struct border_streaks {};
+
     //! @brief The maximum message size ever exchanged by the node.
     struct max_msg {};
 
@@ -153,53 +225,138 @@ namespace tags {
 using set_t = std::unordered_set<device_t>;
 //! @brief Shorthand for a map associating times to messages.
 using map_t = std::unordered_map<message, times_t, common::hash<message>>;
+//! @brief Shorthand for a table associating messages to consecutive rounds as border.
+using table_t = std::unordered_map<message, int, common::hash<message>>;
+
+//! @brief Whether the current node lies on the path of a message along the spanning tree, given the devices below it.
+FUN bool in_path(ARGS, message const& m, set_t const& below) { CODE
+    return below.count(m.from) + below.count(m.to) > 0;
+}
+
+/**
+ * @brief Whether the current node lies in the elliptic channel between the sender and the zone where the receiver can be.
+ *
+ * The receiver is within a given drift from its address, moving since its registration at most
+ * at the speed of the current node: the channel is widened by twice the drift, so that it
+ * contains the whole zone.
+ */
+FUN bool in_path(ARGS, located_message const& m, set_t const&) { CODE
+    double drift = node.storage(tags::speed{}) * (node.current_time() - m.located);
+    vec<3> p = node.position();
+    return distance(p, m.source) + distance(p, m.target) <= distance(m.source, m.target) + routing_width + 2*drift;
+}
 
 //! @brief Main function.
 MAIN() {
     // import tags for convenience
     using namespace tags;
+    // profile the round (if FCPP_PROFILE is defined)
+    PROFILE_SCOPE("main");
     // random walk
-    rectangle_walk(CALL, make_vec(0,0,0), make_vec(side,side,height), node.storage(speed{}), 1);
+    PROFILED("rectangle_walk", rectangle_walk(CALL, make_vec(0,0,0), make_vec(side,side,height), node.storage(speed{}), 1));
+    // the address is registered in the first round, and refreshed every address_period
+    if (old(CALL, true, false) or node.current_time() >= node.storage(home_time{}) + address_period) {
+        node.storage(home{}) = node.position();
+        node.storage(home_time{}) = node.current_time();
+    }
     device_t src_id = 0;
     // distance estimation
     bool is_src = node.uid == src_id;
-    double ds = bis_distance(CALL, is_src, 1, 100);
+    double ds = PROFILED("bis_distance", bis_distance(CALL, is_src, 1, 100));
     // basic node rendering
     node.storage(center_dist{}) = ds;
+#ifndef FCPP_HEADLESS
     node.storage(node_color{}) = color::hsva(ds*hue_scale, 1, 1);
     node.storage(node_shape{}) = is_src ? shape::cube : shape::icosahedron;
     node.storage(node_size{}) = is_src ? 16 : 10;
+#endif
     // spanning tree definition
     device_t parent = get<1>(min_hood(CALL, make_tuple(nbr(CALL, ds), node.nbr_uid())));
-    // routing sets along the tree
-    set_t below = sp_collection(CALL, ds, set_t{node.uid}, set_t{}, [](set_t x, set_t const& y){
+    // routing sets along the tree (only in tree routing, geographic routing needs no state)
+    bool geographic = node.storage(routing{}) == 1;
+    set_t below;
+    if (not geographic) below = PROFILED("sp_collection", sp_collection(CALL, ds, set_t{node.uid}, set_t{}, [](set_t x, set_t const& y){
         x.insert(y.begin(), y.end());
         return x;
-    });
-    // random message with 1% probability during time [10..50]
+    }));
+    // random message with 1% probability during time [10..50] (independent of thread scheduling)
+    philox rng = round_rng(CALL, node.storage(traffic_seed{}));
     common::option<message> m;
-    if (node.current_time() > 10 and node.current_time() < 50 and node.next_real() < 0.01) {
-        m.emplace(node.uid, (device_t)node.next_int(devices-1), node.current_time());
+    common::option<located_message> lm;
+    if (node.current_time() > 10 and node.current_time() < 50 and rng.next_real() < 0.01) {
+        device_t to = (device_t)rng.next_int(devices-1);
+        if (geographic) {
+            // the receiver address is resolved once by the sender, as from a directory where nodes register it
+            bool found = node.net.node_count(to);
+            vec<3> target = found ? node.net.node_at(to).storage(home{}) : node.position();
+            times_t located = found ? node.net.node_at(to).storage(home_time{}) : node.current_time();
+            lm.emplace(node.uid, to, node.current_time(), node.position(), target, located);
+        } else m.emplace(node.uid, to, node.current_time());
         node.storage(sent_count{}) += 1;
     }
-    // dispatches messages
-    std::vector<color> procs{color(BLACK)};
-    map_t r = spawn(CALL, [&](message const& m){
-        procs.push_back(color::hsva(m.to*360.0/devices, 1, 1));
-        bool inpath = below.count(m.from) + below.count(m.to) > 0;
-        status s = node.uid == m.to ? status::terminated_output :
-                   inpath ? status::internal : status::border;
+    // dispatches messages, indexing processes by key in a table of border streaks (when pruning)
+    bool prune = node.storage(pruning{});
+    size_t procs = 0;
+#ifndef FCPP_HEADLESS
+    // colors of the first two active processes
+    color left(BLACK), right(BLACK);
+#endif
+    // the border streaks of the previous round, moved out of the node storage to be replaced by those of this round
+    table_t prev;
+    std::swap(prev, node.storage(border_streaks{}));
+    table_t& table = node.storage(border_streaks{});
+    // the status of the node in the process of a message
+    auto membership = [&](auto const& m){
+        if (node.uid == m.to)
+            return status::terminated_output;
+        // expired processes terminate
+        if (prune and node.current_time() > m.time + process_ttl)
+            return status::terminated;
+        // long-standing border nodes leave the process, checking the path only every border_rounds rounds
+        auto it = prune ? prev.find(m) : prev.end();
+        int streak = it == prev.end() ? 1 : it->second + 1;
+        if (streak > border_rounds + 1 and streak % border_rounds != 0) {
+            table.emplace(m, streak);
+            return status::external;
+        }
+        bool inpath = in_path(CALL, m, below);
+        if (inpath or not prune)
+            return inpath ? status::internal : status::border;
+        table.emplace(m, streak);
+        return streak > border_rounds ? status::external : status::border;
+    };
+    // the same process for both routing modes, whose keys carry positions only in geographic routing
+    auto process = [&](auto const& m){
+        PROFILE_SCOPE("process");
+        status s = membership(m);
+        // a process is active on the node only if it is internal or border
+        if (s == status::internal or s == status::border) {
+#ifndef FCPP_HEADLESS
+            color c = color::hsva(m.to*360.0/devices, 1, 1);
+            if (procs == 0) left = c;
+            if (procs < 2) right = c;
+#endif
+            ++procs;
+        }
         return make_tuple(node.current_time(), s);
-    }, m);
+    };
+    map_t r;
+    if (geographic) {
+        for (auto const& x : PROFILED("spawn", spawn(CALL, process, lm)))
+            r.emplace(x.first, x.second);
+    } else r = PROFILED("spawn", spawn(CALL, process, m));
     // process and msg stats
-    node.storage(max_proc{}) = max(node.storage(max_proc{}), procs.size() - 1);
-    node.storage(tot_proc{}) += procs.size() - 1;
+    node.storage(max_proc{}) = max(node.storage(max_proc{}), procs);
+    node.storage(tot_proc{}) += procs;
     node.storage(max_msg{}) = max(node.storage(max_msg{}), node.msg_size());
     node.storage(tot_msg{}) += node.msg_size();
-    if (procs.size() > 1) node.storage(node_size{}) *= 1.5;
+    PROFILE_EXPORT(node.msg_size());
+#ifndef FCPP_HEADLESS
     // additional node rendering
-    node.storage(left_color{})  = procs[min(int(procs.size()), 2)-1];
-    node.storage(right_color{}) = procs[min(int(procs.size()), 3)-1];
+    if (procs > 0) node.storage(node_size{}) *= 1.5;
+    node.storage(left_color{})  = left;
+    node.storage(right_color{}) = right;
+#endif
     // persist received messages and delivery stats
     r = old(CALL, map_t{}, [&](map_t m){
         for (auto const& x : r) {
@@ -214,7 +371,7 @@ MAIN() {
     });
 }
 //! @brief Exports for the main function.
-FUN_EXPORT main_t = export_list<rectangle_walk_t<3>, bis_distance_t, sp_collection_t<double, set_t>, device_t, spawn_t<message, status>, map_t>;
+FUN_EXPORT main_t = export_list<bool, rectangle_walk_t<3>, bis_distance_t, sp_collection_t<double, set_t>, device_t, round_rng_t, spawn_t<message, status>, spawn_t<located_message, status>, map_t>;
 
 
 }
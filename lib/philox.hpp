@@ -0,0 +1,116 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file philox.hpp
+ * @brief Counter-based random number generation, reproducible regardless of the execution strategy.
+ *
+ * The Philox4x32-10 generator computes random numbers as a pure function of a key and
+ * a counter. Keying it by a seed and node identifier, and counting the rounds of the node,
+ * the random numbers drawn in a round do not depend on thread scheduling, on the number
+ * of threads or on how nodes are distributed among processes.
+ */
+
+#ifndef FCPP_PHILOX_H_
+#define FCPP_PHILOX_H_
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+#include "lib/beautify.hpp"
+#include "lib/coordination.hpp"
+
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Philox4x32-10 counter-based random number generator, drawing a stream of numbers from a key and counter.
+class philox {
+  public:
+    //! @brief The type of the generated numbers.
+    using result_type = uint32_t;
+
+    //! @brief The minimum number generated.
+    static constexpr result_type min() {
+        return 0;
+    }
+
+    //! @brief The maximum number generated.
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    //! @brief Constructor given a key, a counter and the index of the first block of four numbers (to skip ahead in the stream).
+    philox(uint64_t key, uint64_t counter, uint64_t block = 0) : m_key{uint32_t(key), uint32_t(key >> 32)}, m_counter(counter), m_blocks(block) {}
+
+    //! @brief Generates a random number.
+    result_type operator()() {
+        if (m_index == 4) {
+            m_block = generate(m_counter, m_blocks++, m_key);
+            m_index = 0;
+        }
+        return m_block[m_index++];
+    }
+
+    //! @brief Generates a real number uniformly distributed in [0,1).
+    double next_real() {
+        uint64_t x = (uint64_t((*this)()) << 32) | (*this)();
+        return (x >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    //! @brief Generates an integer number uniformly distributed in [0,n].
+    uint64_t next_int(uint64_t n) {
+        return uint64_t(next_real() * (n + 1));
+    }
+
+  private:
+    //! @brief Computes a block of four numbers, given the counter, the block index and the key.
+    static std::array<uint32_t, 4> generate(uint64_t counter, uint64_t block, std::array<uint32_t, 2> k) {
+        std::array<uint32_t, 4> c{uint32_t(counter), uint32_t(counter >> 32), uint32_t(block), uint32_t(block >> 32)};
+        for (int r = 0; r < 10; ++r) {
+            uint64_t p0 = uint64_t(0xD2511F53) * c[0];
+            uint64_t p1 = uint64_t(0xCD9E8D57) * c[2];
+            c = {uint32_t(p1 >> 32) ^ c[1] ^ k[0], uint32_t(p1), uint32_t(p0 >> 32) ^ c[3] ^ k[1], uint32_t(p0)};
+            k[0] += 0x9E3779B9;
+            k[1] += 0xBB67AE85;
+        }
+        return c;
+    }
+
+    //! @brief The key.
+    std::array<uint32_t, 2> m_key;
+    //! @brief The counter.
+    uint64_t m_counter;
+    //! @brief The index of the next block.
+    uint64_t m_blocks;
+    //! @brief The current block.
+    std::array<uint32_t, 4> m_block;
+    //! @brief The index of the next number in the current block.
+    int m_index = 4;
+};
+
+
+//! @brief Namespace containing the libraries of coordination routines.
+namespace coordination {
+
+
+//! @brief Random number generator for the current round, keyed by a seed, the node identifier and the number of rounds of the node.
+FUN philox round_rng(ARGS, uint32_t seed) { CODE
+    uint32_t r = old(CALL, uint32_t(0), [](uint32_t r){
+        return r+1;
+    }) - 1;
+    return {(uint64_t(node.uid) << 32) | seed, r};
+}
+//! @brief Exports for the round_rng function.
+FUN_EXPORT round_rng_t = common::export_list<uint32_t>;
+
+
+}
+
+
+}
+
+#endif // FCPP_PHILOX_H_
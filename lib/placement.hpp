@@ -0,0 +1,152 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file placement.hpp
+ * @brief Placement of processes on the cores of a machine, according to its socket and core topology.
+ *
+ * A placement sets the affinity of the calling thread (meant to be the main thread of the
+ * process). Worker threads created afterwards inherit it, so that batch executions started
+ * afterwards only run on the selected cores, and node memory they allocate is local to
+ * the socket (on first touch); threads that are already running keep their affinity.
+ * The `socket` and `physical` policies confine every process to a single socket, so that
+ * they only use the whole machine if there are at least as many processes as sockets.
+ * Placement is only supported on Linux, where the topology is read from
+ * `/sys/devices/system/cpu`; elsewhere it has no effect.
+ */
+
+#ifndef FCPP_PLACEMENT_H_
+#define FCPP_PLACEMENT_H_
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Policies for placing processes on cores.
+enum class placement {
+    //! @brief No placement (left to the operating system).
+    os,
+    //! @brief Every process is confined to the cores of one socket (sockets are assigned round-robin to processes on the same machine).
+    socket,
+    //! @brief As `socket`, excluding SMT siblings (only one hardware thread per physical core).
+    physical
+};
+
+//! @brief The name of a placement policy.
+inline std::string placement_name(placement p) {
+    switch (p) {
+        case placement::os:       return "os";
+        case placement::socket:   return "socket";
+        case placement::physical: return "physical";
+    }
+    return "";
+}
+
+
+//! @brief Namespace for implementation details.
+namespace details {
+    //! @brief Reads an integer from a file (-1 if not available).
+    inline int read_int(std::string const& file) {
+        std::ifstream f(file);
+        int x = -1;
+        f >> x;
+        return x;
+    }
+
+#ifdef __linux__
+    //! @brief The affinity mask of the process before any placement (the CPUs online and allowed to it).
+    inline cpu_set_t const& original_affinity() {
+        static cpu_set_t const mask = [](){
+            cpu_set_t m;
+            CPU_ZERO(&m);
+            if (sched_getaffinity(0, sizeof(m), &m) != 0)
+                for (size_t c = 0; c < std::thread::hardware_concurrency(); ++c) CPU_SET(c, &m);
+            return m;
+        }();
+        return mask;
+    }
+
+    //! @brief The socket and core of every CPU in the original affinity of the process.
+    inline std::vector<std::pair<int, std::pair<int, int>>> topology() {
+        cpu_set_t const& online = original_affinity();
+        std::vector<std::pair<int, std::pair<int, int>>> t;
+        for (int c = 0; c < CPU_SETSIZE; ++c) if (CPU_ISSET(c, &online)) {
+            std::string dir = "/sys/devices/system/cpu/cpu" + std::to_string(c) + "/topology/";
+            t.emplace_back(c, std::make_pair(read_int(dir + "physical_package_id"), read_int(dir + "core_id")));
+        }
+        return t;
+    }
+#endif
+}
+
+
+//! @brief The number of sockets available to the process (one where the topology is not available).
+inline size_t socket_count() {
+    std::set<int> sockets;
+#ifdef __linux__
+    for (auto const& c : details::topology()) sockets.insert(c.second.first);
+#endif
+    return std::max(sockets.size(), size_t(1));
+}
+
+
+/**
+ * @brief Places the current process according to a policy, returning the number of hardware threads available to it.
+ *
+ * The affinity is set for the calling thread, and inherited by the threads it creates afterwards:
+ * it should be called by the main thread, before starting the worker threads.
+ * Every call starts from the affinity that the process had before the first placement,
+ * which the `os` policy restores, so that policies can be compared within the same run.
+ *
+ * @param p The placement policy.
+ * @param local_rank The index of the process among those on the same machine.
+ * @param local_procs The number of processes on the same machine.
+ */
+inline size_t place_process(placement p, int local_rank, int local_procs) {
+    size_t n = std::thread::hardware_concurrency();
+#ifdef __linux__
+    // socket and core of every CPU available
+    auto topology = details::topology();
+    std::set<int> sockets;
+    for (auto const& c : topology) sockets.insert(c.second.first);
+    std::vector<int> sock(sockets.begin(), sockets.end());
+    // the socket assigned to the process, round-robin
+    int target = sock.empty() ? -1 : sock[local_rank % sock.size()];
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    std::set<std::pair<int, int>> cores;
+    size_t count = 0;
+    for (auto const& c : topology) {
+        if (p != placement::os) {
+            if (c.second.first != target) continue;
+            if (p == placement::physical and not cores.insert(c.second).second) continue;
+        }
+        CPU_SET(c.first, &mask);
+        ++count;
+    }
+    // processes share cores if there are more of them than sockets
+    size_t sharing = p == placement::os ? local_procs : (local_procs + sock.size() - 1) / sock.size();
+    // sets the affinity of the calling thread
+    if (count > 0 and sched_setaffinity(0, sizeof(mask), &mask) == 0)
+        return std::max(count / sharing, size_t(1));
+#endif
+    return std::max(n / local_procs, size_t(1));
+}
+
+}
+
+#endif // FCPP_PLACEMENT_H_
@@ -0,0 +1,186 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file profiling.hpp
+ * @brief Opt-in profiling of scopes in aggregate functions, producing flame-graph-compatible profiles.
+ *
+ * Profiling is enabled by defining the `FCPP_PROFILE` macro; otherwise, the `PROFILE_SCOPE`,
+ * `PROFILED` and `PROFILE_EXPORT` macros expand to nothing (or to the profiled expression).
+ * When enabled, the cumulative time and number of calls of every scope are recorded by
+ * stack of enclosing scopes, together with the export sizes reported in them. At the
+ * end of the program, the profile is written in folded stack format (one line per stack,
+ * with its self time in nanoseconds) to the file named by the `FCPP_PROFILE_OUTPUT`
+ * environment variable (`profile.folded` by default), and a summary is printed on standard error.
+ */
+
+#ifndef FCPP_PROFILING_H_
+#define FCPP_PROFILING_H_
+
+#ifdef FCPP_PROFILE
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Namespace containing profiling tools.
+namespace profiling {
+
+
+//! @brief Statistics collected for a stack of scopes.
+struct entry {
+    //! @brief Number of calls.
+    size_t calls = 0;
+    //! @brief Total time (in nanoseconds), including nested scopes.
+    double total = 0;
+    //! @brief Time spent in the scope itself (in nanoseconds), excluding nested scopes.
+    double self = 0;
+    //! @brief Number of exports reported.
+    size_t exports = 0;
+    //! @brief Total size of exports reported (in bytes).
+    size_t bytes = 0;
+
+    //! @brief Merges statistics from another entry.
+    entry& operator+=(entry const& e) {
+        calls += e.calls;
+        total += e.total;
+        self += e.self;
+        exports += e.exports;
+        bytes += e.bytes;
+        return *this;
+    }
+};
+
+//! @brief Statistics collected by a thread, with the stack of currently open scopes.
+struct table {
+    //! @brief The statistics by stack of scopes (names separated by semicolons).
+    std::unordered_map<std::string, entry> entries;
+    //! @brief The current stack of scopes.
+    std::string path;
+    //! @brief Lengths of the path and time spent in nested scopes, for every open scope.
+    std::vector<std::pair<size_t, double>> open;
+};
+
+//! @brief Collects the tables of every thread, writing the profile on destruction.
+class registry {
+  public:
+    //! @brief The unique instance of the registry.
+    static registry& instance() {
+        static registry r;
+        return r;
+    }
+
+    //! @brief The table of the current thread.
+    static table& local() {
+        thread_local table* t = instance().add();
+        return *t;
+    }
+
+    //! @brief Writes the profile.
+    ~registry() {
+        std::map<std::string, entry> m;
+        for (auto const& t : m_tables)
+            for (auto const& x : t->entries)
+                m[x.first] += x.second;
+        char const* name = std::getenv("FCPP_PROFILE_OUTPUT");
+        std::ofstream f(name == nullptr ? "profile.folded" : name);
+        for (auto const& x : m)
+            f << x.first << " " << size_t(x.second.self) << "\n";
+        std::cerr << "scope\tcalls\ttotal (ms)\tself (ms)\tavg export (bytes)\n";
+        for (auto const& x : m)
+            std::cerr << x.first << "\t" << x.second.calls << "\t" << x.second.total * 1e-6 << "\t" << x.second.self * 1e-6 << "\t" << (x.second.exports ? double(x.second.bytes) / x.second.exports : 0) << "\n";
+    }
+
+  private:
+    //! @brief Adds a table for a new thread.
+    table* add() {
+        std::lock_guard<std::mutex> l(m_mutex);
+        m_tables.emplace_back(new table());
+        return m_tables.back().get();
+    }
+
+    //! @brief Mutex regulating addition of tables.
+    std::mutex m_mutex;
+    //! @brief The tables of every thread.
+    std::vector<std::unique_ptr<table>> m_tables;
+};
+
+//! @brief Profiles the lifetime of the object as a scope with given name.
+class scope {
+  public:
+    //! @brief Opens the scope.
+    scope(char const* name) : m_table(registry::local()), m_start(std::chrono::high_resolution_clock::now()) {
+        m_table.open.emplace_back(m_table.path.size(), 0.0);
+        if (not m_table.path.empty()) m_table.path += ";";
+        m_table.path += name;
+    }
+
+    //! @brief Closes the scope.
+    ~scope() {
+        double t = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - m_start).count();
+        entry& e = m_table.entries[m_table.path];
+        e.calls += 1;
+        e.total += t;
+        e.self += t - m_table.open.back().second;
+        m_table.path.resize(m_table.open.back().first);
+        m_table.open.pop_back();
+        if (not m_table.open.empty()) m_table.open.back().second += t;
+    }
+
+  private:
+    //! @brief The table of the current thread.
+    table& m_table;
+    //! @brief The opening time.
+    std::chrono::high_resolution_clock::time_point m_start;
+};
+
+//! @brief Reports the size of an export within the current scope.
+inline void report_export(size_t bytes) {
+    table& t = registry::local();
+    entry& e = t.entries[t.path];
+    e.exports += 1;
+    e.bytes += bytes;
+}
+
+
+}
+
+
+}
+
+//! @brief Concatenates tokens after macro expansion.
+#define FCPP_PROFILE_CAT(x, y)      FCPP_PROFILE_CAT_(x, y)
+//! @brief Concatenates tokens.
+#define FCPP_PROFILE_CAT_(x, y)     x##y
+//! @brief Profiles the rest of the current block as a scope with given name.
+#define PROFILE_SCOPE(name)         fcpp::profiling::scope FCPP_PROFILE_CAT(profile_scope_, __LINE__){name}
+//! @brief Profiles the evaluation of an expression as a scope with given name.
+#define PROFILED(name, ...)         [&]() -> decltype(auto) { PROFILE_SCOPE(name); return __VA_ARGS__; }()
+//! @brief Reports the size of an export within the current scope.
+#define PROFILE_EXPORT(bytes)       fcpp::profiling::report_export(bytes)
+
+#else
+
+//! @brief Profiles the rest of the current block as a scope with given name (disabled).
+#define PROFILE_SCOPE(name)
+//! @brief Profiles the evaluation of an expression as a scope with given name (disabled).
+#define PROFILED(name, ...)         (__VA_ARGS__)
+//! @brief Reports the size of an export within the current scope (disabled).
+#define PROFILE_EXPORT(bytes)
+
+#endif
+
+#endif // FCPP_PROFILING_H_
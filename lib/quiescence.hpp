@@ -0,0 +1,98 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file quiescence.hpp
+ * @brief Detection of quiescent nodes, whose inputs have not changed since their last round, and elision of their rounds.
+ */
+
+#ifndef FCPP_QUIESCENCE_H_
+#define FCPP_QUIESCENCE_H_
+
+#include "lib/beautify.hpp"
+#include "lib/coordination.hpp"
+#include "lib/data.hpp"
+
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Namespace containing the libraries of coordination routines.
+namespace coordination {
+
+
+namespace tags {
+    //! @brief Tolerance below which input changes are ignored by quiescent nodes (zero, the default, disables round elision).
+    struct quiescence_tolerance {};
+
+    //! @brief Total number of rounds elided by the node because of quiescence.
+    struct elided_rounds {};
+}
+
+
+//! @brief Absolute variation of a value since the previous round (zero for infinite values not changing).
+FUN double variation(ARGS, double x) { CODE
+    double y = old(CALL, x);
+    return x == y ? 0 : std::abs(x - y);
+}
+//! @brief Exports for the variation function.
+FUN_EXPORT variation_t = common::export_list<double>;
+
+/**
+ * @brief Number of consecutive rounds in which neither the node nor its neighbours changed.
+ *
+ * A node changes in a round if its inputs vary by more than a given tolerance,
+ * or if its neighbourhood gains or loses devices.
+ */
+FUN int quiescent_rounds(ARGS, double change, double tolerance) { CODE
+    int n = count_hood(CALL);
+    bool steady = change <= tolerance and n == old(CALL, n);
+    bool calm = fold_hood(CALL, [](bool x, bool y){
+        return x and y;
+    }, nbr(CALL, steady), steady);
+    return old(CALL, 0, [&](int r){
+        return calm ? r+1 : 0;
+    });
+}
+//! @brief Exports for the quiescent_rounds function.
+FUN_EXPORT quiescent_rounds_t = common::export_list<bool, int>;
+
+/**
+ * @brief Elides rounds of nodes that have been quiescent for a given number of rounds.
+ *
+ * The tolerance is read from the `quiescence_tolerance` storage tag: while it is not
+ * positive, nothing is computed or exported. The next round of a quiescent node is
+ * postponed by up to `max_skip` round periods, so that the export it last sent is still
+ * retained by neighbours; the period is the last interval between rounds (net of the
+ * rounds it elided), following the round schedule of the node. The number of elided
+ * rounds is accumulated in the `elided_rounds` storage tag.
+ *
+ * Positions are not part of the change measure: movement matters only through the
+ * inputs it affects, which in moving deployments usually vary at every round.
+ *
+ * @return Whether the next rounds of the node are going to be elided.
+ */
+FUN bool quiescence(ARGS, double change, int threshold, int max_skip) { CODE
+    double tolerance = node.storage(tags::quiescence_tolerance{});
+    if (tolerance <= 0) return false;
+    int r = quiescent_rounds(CALL, change, tolerance);
+    int skip = r < threshold ? 0 : min(r - threshold + 1, max_skip);
+    int last = old(CALL, 0, skip);
+    if (skip == 0) return false;
+    times_t period = (node.current_time() - node.previous_time()) / (last + 1);
+    node.next_time(node.current_time() + (skip + 1) * period);
+    node.storage(tags::elided_rounds{}) += skip;
+    return true;
+}
+//! @brief Exports for the quiescence function.
+FUN_EXPORT quiescence_t = common::export_list<quiescent_rounds_t>;
+
+
+}
+
+
+}
+
+#endif // FCPP_QUIESCENCE_H_
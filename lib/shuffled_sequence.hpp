@@ -0,0 +1,141 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file shuffled_sequence.hpp
+ * @brief Lazily shuffled view of an indexed sequence, without materialising its elements.
+ *
+ * The shuffle is a pseudo-random bijection of the indices, computed on demand through a
+ * Feistel network (with cycle walking to the size of the sequence). Constructing the view
+ * takes constant time and memory, regardless of the size of the sequence, so that it can
+ * be passed to `batch::run` in place of the sequence (with the shuffle of the execution
+ * policy disabled). The view supports the same interface as the sequences produced by
+ * `batch::make_tagged_tuple_sequences` (`size`, `empty`, `operator[]`, `slice` and `shuffle`),
+ * where slicing and shuffling only add a step to the mapping of indices.
+ */
+
+#ifndef FCPP_SHUFFLED_SEQUENCE_H_
+#define FCPP_SHUFFLED_SEQUENCE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Lazily shuffled view of a sequence supporting `size()` and `operator[]`.
+template <typename S>
+class shuffled_sequence {
+  public:
+    //! @brief The type of the elements of the sequence.
+    using value_type = std::decay_t<decltype(std::declval<S const&>()[0])>;
+
+    //! @brief Constructor given the sequence to be shuffled and a seed.
+    shuffled_sequence(S seq, uint64_t seed) : m_seq(std::move(seq)), m_size(m_seq.size()) {
+        shuffle(seed);
+    }
+
+    //! @brief The number of elements in the view.
+    size_t size() const {
+        return m_size;
+    }
+
+    //! @brief Whether the view has no elements.
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    //! @brief The element of given index in the view.
+    value_type operator[](size_t i) const {
+        for (size_t k = m_steps.size(); k-- > 0; )
+            i = m_steps[k](i);
+        return m_seq[i];
+    }
+
+    //! @brief Restricts the view to the elements with indices from `start` (included) to `end` (excluded) with a given `stride`.
+    void slice(size_t start, size_t end, size_t stride = 1) {
+        end = std::min(end, m_size);
+        size_t n = start < end ? (end - start + stride - 1) / stride : 0;
+        if (m_steps.empty() or m_steps.back().bits > 0) m_steps.push_back({0, 0, m_size, 0, 1});
+        step& s = m_steps.back();
+        s.start += start * s.stride;
+        s.stride *= stride;
+        m_size = n;
+    }
+
+    //! @brief Shuffles the elements of the view with a given seed.
+    void shuffle(uint64_t seed = 0) {
+        step s{seed, 1, m_size, 0, 1};
+        while ((uint64_t(1) << (2*s.bits)) < m_size) ++s.bits;
+        m_steps.push_back(s);
+    }
+
+  private:
+    //! @brief A step of the mapping of indices, applying a bijection (if bits are positive) and then a slice.
+    struct step {
+        //! @brief The seed of the bijection.
+        uint64_t seed;
+        //! @brief Half of the number of bits of the Feistel network domain (zero for no bijection).
+        int bits;
+        //! @brief The number of indices permuted by the bijection.
+        size_t domain;
+        //! @brief The first index of the slice.
+        size_t start;
+        //! @brief The stride of the slice.
+        size_t stride;
+
+        //! @brief Maps an index of the view into an index of the previous view.
+        size_t operator()(size_t i) const {
+            return start + stride * (bits > 0 ? permute(i) : i);
+        }
+
+        //! @brief Pseudo-random round function of the Feistel network.
+        uint64_t round(uint64_t x, int r) const {
+            x ^= seed + 0x9E3779B97F4A7C15ull * (r + 1);
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+            return x ^ (x >> 31);
+        }
+
+        //! @brief Bijection of the indices below the domain size.
+        size_t permute(size_t i) const {
+            uint64_t mask = (uint64_t(1) << bits) - 1;
+            uint64_t x = i;
+            do {
+                uint64_t l = x >> bits, r = x & mask;
+                for (int k = 0; k < 4; ++k) {
+                    uint64_t t = r;
+                    r = l ^ (round(r, k) & mask);
+                    l = t;
+                }
+                x = (l << bits) | r;
+            } while (x >= domain);
+            return x;
+        }
+    };
+
+    //! @brief The underlying sequence.
+    S m_seq;
+    //! @brief The number of elements in the view.
+    size_t m_size;
+    //! @brief The steps mapping indices of the view into indices of the sequence (the last applied first).
+    std::vector<step> m_steps;
+};
+
+//! @brief Lazily shuffles a sequence supporting `size()` and `operator[]`.
+template <typename S>
+shuffled_sequence<S> make_shuffled_sequence(S seq, uint64_t seed) {
+    return {std::move(seq), seed};
+}
+
+
+}
+
+#endif // FCPP_SHUFFLED_SEQUENCE_H_
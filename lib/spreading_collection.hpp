@@ -5,6 +5,8 @@
  * @brief Simple composition of spreading and collection functions.
  *
  * This header file is designed to work under multiple execution paradigms.
+ * Defining the `FCPP_HEADLESS` macro before including it removes from nodes
+ * all data used only for rendering, for executions without a GUI.
  */
 
 #ifndef FCPP_SPREADING_COLLECTION_H_
@@ -12,6 +14,11 @@
 
 #include "lib/fcpp.hpp"
 
+#include "lib/compression.hpp"
+#include "lib/profiling.hpp"
+#include "lib/quiescence.hpp"
+#include "lib/tracing.hpp"
+
 
 /**
  * @brief Namespace containing all the objects in the FCPP library.
@@ -68,6 +75,10 @@ namespace tags {
     struct node_size {};
     //! @brief Shape of the current node.
     struct node_shape {};
+    //! @brief The maximum message size ever exchanged by the node.
+    struct max_msg {};
+    //! @brief The total message size ever exchanged by the node.
+    struct tot_msg {};
 }
 
 
@@ -82,8 +93,10 @@ FUN bool select_source(ARGS, int step) { CODE
         source_pos = node.net.node_at(source_id).position(node.current_time());
     // store relevant values in the node storage
     node.storage(tags::true_distance{})     = distance(node.position(), source_pos);
+#ifndef FCPP_HEADLESS
     node.storage(tags::node_size{})         = is_source ? 20 : 10;
     node.storage(tags::node_shape{})        = is_source ? shape::star : shape::sphere;
+#endif
     return is_source;
 }
 //! @brief Export types used by the select_source function (none).
@@ -92,37 +105,53 @@ FUN_EXPORT select_source_t = common::export_list<>;
 
 //! @brief Main function.
 MAIN() {
+    // profile the round (if FCPP_PROFILE is defined)
+    PROFILE_SCOPE("main");
+    // trace the round and the messages received (if FCPP_EVENT_TRACE is defined)
+    TRACE_SCOPE("round", node.uid);
+    TRACE_EVENT("receive", fcpp::details::get_ids(node.nbr_uid()).size());
     // access stored constants
     double const& side      = node.storage(tags::side{});
     double const& speed     = node.storage(tags::speed{});
-    double const& hue_scale = node.storage(tags::hue_scale{});
     // random walk into a given rectangle with given speed
-    rectangle_walk(CALL, make_vec(0,0,0), make_vec(side,side,height), speed, 1);
+    PROFILED("rectangle_walk", rectangle_walk(CALL, make_vec(0,0,0), make_vec(side,side,height), speed, 1));
     // selects a different source every 50 simulated seconds
-    bool is_source = select_source(CALL, 50);
+    bool is_source = PROFILED("select_source", select_source(CALL, 50));
     // calculate distances from the source
-    double dist = abf_distance(CALL, is_source);
+    double dist = PROFILED("abf_distance", abf_distance(CALL, is_source));
     // collect the maximum finite distance (diameter) back towards the source
-    double sdiam = mp_collection(CALL, dist, dist, 0.0, [](double x, double y){
+    double sdiam = PROFILED("mp_collection", mp_collection(CALL, dist, dist, 0.0, [](double x, double y){
         x = isfinite(x) ? x : 0;
         y = isfinite(y) ? y : 0;
         return max(x, y);
     }, [](double x, int){
         return x;
-    });
+    }));
     // broadcast the diameter computed in the source to the whole network
-    double diam = broadcast(CALL, dist, sdiam);
+    double precision = node.storage(tags::export_precision{});
+    double diam = PROFILED("broadcast", precision > 0 ? compressed_broadcast(CALL, dist, sdiam, precision, 10) : broadcast(CALL, dist, sdiam));
     // store relevant values in the node storage
     node.storage(tags::calc_distance{})     = dist;
     node.storage(tags::source_diameter{})   = sdiam;
     node.storage(tags::diameter{})          = diam;
+#ifndef FCPP_HEADLESS
     // store colors, using the values to regulate hue (with full saturation and value)
+    double const& hue_scale = node.storage(tags::hue_scale{});
     node.storage(tags::distance_c{})        = color::hsva(dist *hue_scale, 1, 1);
     node.storage(tags::source_diameter_c{}) = color::hsva(sdiam*hue_scale, 1, 1);
     node.storage(tags::diameter_c{})        = color::hsva(diam *hue_scale, 1, 1);
+#endif
+    // elide rounds while nothing changes (after 3 quiet rounds, at most 1 round out of 2)
+    double change = max(max(variation(CALL, dist), variation(CALL, sdiam)), max(variation(CALL, diam), variation(CALL, is_source)));
+    PROFILED("quiescence", quiescence(CALL, change, 3, 1));
+    // store message size statistics
+    node.storage(tags::max_msg{}) = max(node.storage(tags::max_msg{}), node.msg_size());
+    node.storage(tags::tot_msg{}) += node.msg_size();
+    PROFILE_EXPORT(node.msg_size());
+    TRACE_EVENT("send", node.msg_size());
 }
 //! @brief Export types used by the main function.
-FUN_EXPORT main_t = common::export_list<rectangle_walk_t<3>, select_source_t, abf_distance_t, mp_collection_t<double, double>, broadcast_t<double, double>>;
+FUN_EXPORT main_t = common::export_list<rectangle_walk_t<3>, select_source_t, abf_distance_t, mp_collection_t<double, double>, broadcast_t<double, double>, compressed_broadcast_t, variation_t, quiescence_t>;
 
 
 } // namespace coordination
@@ -147,8 +176,8 @@ using round_s = sequence::periodic<
     >,
     distribution::constant_n<times_t, end_time+2>  // the constant end_time+2 number for end
 >;
-//! @brief The sequence of network snapshots (one every simulated second).
-using log_s = sequence::periodic_n<1, 0, 1, end_time>;
+//! @brief The sequence of network snapshots (one every simulated second, traced if FCPP_EVENT_TRACE is defined).
+using log_s = tracing::traced_schedule<sequence::periodic_n<1, 0, 1, end_time>>;
 //! @brief The sequence of node generation events (multiple devices all generated at time 0).
 using spawn_s = sequence::multiple<
     distribution::constant_i<size_t, devices>,
@@ -175,24 +204,50 @@ using speed_d = functor::mul<
     distribution::constant_i<double, speed>,
     distribution::constant_n<double, comm, 100>
 >;
-//! @brief The contents of the node storage as tags and associated types.
+//! @brief The contents of the node storage as tags and associated types (excluding rendering data).
 using store_t = tuple_store<
     side,               double,
-    hue_scale,          double,
     speed,              double,
     true_distance,      double,
     calc_distance,      double,
     source_diameter,    double,
     diameter,           double,
-    distance_c,         color,
-    source_diameter_c,  color,
-    diameter_c,         color,
-    node_shape,         shape,
-    node_size,          double
+    quiescence_tolerance, double,
+    export_precision,   double,
+    elided_rounds,      size_t,
+    max_msg,            size_t,
+    tot_msg,            size_t
 >;
+#ifdef FCPP_HEADLESS
+//! @brief The options for rendering nodes (none in headless mode).
+DECLARE_OPTIONS(render_t,
+    tuple_store<>
+);
+#else
+//! @brief The options for rendering nodes: rendering data in the node storage, its initialisation, and how it is used.
+DECLARE_OPTIONS(render_t,
+    tuple_store<
+        hue_scale,          double,
+        distance_c,         color,
+        source_diameter_c,  color,
+        diameter_c,         color,
+        node_shape,         shape,
+        node_size,          double
+    >,
+    init<
+        hue_scale,  hue_d        // initialise hue_scale based on globally provided area side
+    >,
+    shape_tag<node_shape>, // the shape of a node is read from this tag in the store
+    size_tag<node_size>,   // the size of a node is read from this tag in the store
+    color_tag<distance_c, source_diameter_c, diameter_c> // colors of a node are read from these
+);
+#endif
 //! @brief The tags and corresponding aggregators to be logged.
 using aggregator_t = aggregators<
     true_distance,      aggregator::max<double>,
+    elided_rounds,      aggregator::sum<size_t>,
+    max_msg,            aggregator::max<size_t>,
+    tot_msg,            aggregator::sum<size_t>,
     diameter,           aggregator::only_finite<aggregator::combine<
                             aggregator::min<double>,
                             aggregator::mean<double>,
@@ -217,21 +272,19 @@ using speed_plot_t = plot::split<speed, plot::filter<plot::time, filter::above<5
 using plot_t = plot::join<time_plot_t, tvar_plot_t, dens_plot_t, hops_plot_t, speed_plot_t>;
 
 
-//! @brief The general simulation options.
-DECLARE_OPTIONS(list,
-    parallel<false>,     // no multithreading on node rounds
-    synchronised<false>, // optimise for asynchronous networks
+//! @brief The simulation options, excluding the execution strategy flags.
+DECLARE_OPTIONS(base,
     program<coordination::main>,   // program to be run (refers to MAIN above)
     exports<coordination::main_t>, // export type list (types used in messages)
     round_schedule<round_s>, // the sequence generator for round events on nodes
     log_schedule<log_s>,     // the sequence generator for log events on the network
     spawn_schedule<spawn_s>, // the sequence generator of node creation events on the network
     store_t,       // the contents of the node storage
+    render_t,      // the options for rendering nodes
     aggregator_t,  // the tags and corresponding aggregators to be logged
     init<
         x,          rectangle_d, // initialise position randomly in a rectangle for new nodes
         side,       side_d,      // initialise side with the globally provided simulation area side
-        hue_scale,  hue_d,       // initialise hue_scale based on globally provided area side
         speed,      speed_d      // initialise speed with the globally provided speed for new nodes
     >,
     // general parameters to use for plotting
@@ -243,10 +296,15 @@ DECLARE_OPTIONS(list,
     >,
     plot_type<plot_t>, // the plot description to be used
     dimension<dim>, // dimensionality of the space
-    connector<connect::fixed<comm, 1, dim>>, // connection allowed within a fixed comm range
-    shape_tag<node_shape>, // the shape of a node is read from this tag in the store
-    size_tag<node_size>,   // the size of a node is read from this tag in the store
-    color_tag<distance_c, source_diameter_c, diameter_c> // colors of a node are read from these
+    connector<connect::fixed<comm, 1, dim>> // connection allowed within a fixed comm range
+);
+
+//! @brief The general simulation options.
+DECLARE_OPTIONS(list,
+    parallel<false>,     // no multithreading on node rounds
+    synchronised<false>, // optimise for asynchronous networks
+    export_split<true>,  // do not send to neighbours data meant only for the node itself
+    base                 // the simulation options above
 );
 
 
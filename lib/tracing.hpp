@@ -0,0 +1,259 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file tracing.hpp
+ * @brief Opt-in tracing of events in aggregate programs and batch executions, producing Chrome trace files.
+ *
+ * Tracing is enabled by defining the `FCPP_EVENT_TRACE` macro; otherwise, the `TRACE_SCOPE`,
+ * `TRACE_EVENT` and `TRACE_RANK` macros expand to nothing, and `traced_schedule<S>` is `S`.
+ * A log schedule wrapped in `traced_schedule` traces every log event, and the whole simulation
+ * owning it (as a "batch" event, since the schedule lives as long as its network). When enabled, every thread
+ * records events in its own ring buffer (without locking), keeping the latest
+ * `FCPP_EVENT_TRACE_CAPACITY` events. At the end of the program, the events of every thread
+ * are written in Chrome trace JSON format (readable by Perfetto) to the file
+ * `<prefix>.<rank>.json`, where the prefix is given by the `FCPP_EVENT_TRACE_OUTPUT`
+ * environment variable (`trace` by default) and the rank is the MPI rank (zero by default).
+ */
+
+#ifndef FCPP_TRACING_H_
+#define FCPP_TRACING_H_
+
+#ifdef FCPP_EVENT_TRACE
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+//! @brief Number of events kept by every thread.
+#ifndef FCPP_EVENT_TRACE_CAPACITY
+#define FCPP_EVENT_TRACE_CAPACITY 65536
+#endif
+
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Namespace containing tracing tools.
+namespace tracing {
+
+
+//! @brief A traced event.
+struct event {
+    //! @brief The name of the event.
+    char const* name;
+    //! @brief The start time (in nanoseconds since the start of the program).
+    int64_t start;
+    //! @brief The duration (in nanoseconds, negative for instant events).
+    int64_t duration;
+    //! @brief A numeric argument of the event.
+    int64_t arg;
+};
+
+//! @brief Ring buffer of the events of a thread.
+class buffer {
+  public:
+    //! @brief Constructor given the thread identifier.
+    buffer(size_t tid) : m_tid(tid), m_events(FCPP_EVENT_TRACE_CAPACITY) {}
+
+    //! @brief Records an event, overwriting the oldest if the buffer is full.
+    void push(event const& e) {
+        m_events[m_count++ % m_events.size()] = e;
+    }
+
+    //! @brief Writes the recorded events as JSON objects, given the process identifier (times in microseconds, with nanosecond digits).
+    void write(std::ostream& o, int pid, bool& first) const {
+        o << std::fixed << std::setprecision(3);
+        size_t n = m_events.size();
+        for (size_t i = m_count > n ? m_count - n : 0; i < m_count; ++i) {
+            event const& e = m_events[i % n];
+            o << (first ? "\n" : ",\n") << "{\"name\":\"" << e.name << "\",\"pid\":" << pid << ",\"tid\":" << m_tid << ",\"ts\":" << e.start * 1e-3;
+            if (e.duration < 0) o << ",\"ph\":\"i\",\"s\":\"t\"";
+            else o << ",\"ph\":\"X\",\"dur\":" << e.duration * 1e-3;
+            o << ",\"args\":{\"value\":" << e.arg << "}}";
+            first = false;
+        }
+    }
+
+  private:
+    //! @brief The thread identifier.
+    size_t m_tid;
+    //! @brief The number of events ever recorded.
+    size_t m_count = 0;
+    //! @brief The recorded events.
+    std::vector<event> m_events;
+};
+
+//! @brief Collects the buffers of every thread, writing the trace on destruction.
+class registry {
+  public:
+    //! @brief The unique instance of the registry.
+    static registry& instance() {
+        static registry r;
+        return r;
+    }
+
+    //! @brief The buffer of the current thread.
+    static buffer& local() {
+        thread_local buffer* b = instance().add();
+        return *b;
+    }
+
+    //! @brief Nanoseconds elapsed since the start of the program.
+    int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+    }
+
+    //! @brief Sets the MPI rank of the current process.
+    void rank(int r) {
+        m_rank = r;
+    }
+
+    //! @brief A new identifier for a simulation run by the current process.
+    int64_t simulation() {
+        return m_simulations++;
+    }
+
+    //! @brief Writes the trace.
+    ~registry() {
+        char const* prefix = std::getenv("FCPP_EVENT_TRACE_OUTPUT");
+        std::ofstream f(std::string(prefix == nullptr ? "trace" : prefix) + "." + std::to_string(m_rank) + ".json");
+        f << "{\"traceEvents\":[";
+        bool first = true;
+        for (auto const& b : m_buffers) b->write(f, m_rank, first);
+        f << "\n]}\n";
+    }
+
+  private:
+    //! @brief Adds a buffer for a new thread.
+    buffer* add() {
+        std::lock_guard<std::mutex> l(m_mutex);
+        m_buffers.emplace_back(new buffer(m_buffers.size()));
+        return m_buffers.back().get();
+    }
+
+    //! @brief The start time of the program.
+    std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+    //! @brief The MPI rank of the current process.
+    int m_rank = 0;
+    //! @brief The number of simulations started by the current process.
+    std::atomic<int64_t> m_simulations{0};
+    //! @brief Mutex regulating addition of buffers.
+    std::mutex m_mutex;
+    //! @brief The buffers of every thread.
+    std::vector<std::unique_ptr<buffer>> m_buffers;
+};
+
+//! @brief Traces the lifetime of the object as an event with given name and argument.
+class scope {
+  public:
+    //! @brief Starts the event (after getting the buffer, so that its allocation is not traced).
+    scope(char const* name, int64_t arg) : m_buffer(registry::local()), m_name(name), m_arg(arg), m_start(registry::instance().now()) {}
+
+    //! @brief Ends the event.
+    ~scope() {
+        m_buffer.push({m_name, m_start, registry::instance().now() - m_start, m_arg});
+    }
+
+  private:
+    //! @brief The buffer of the thread starting the event.
+    buffer& m_buffer;
+    //! @brief The name of the event.
+    char const* m_name;
+    //! @brief The argument of the event.
+    int64_t m_arg;
+    //! @brief The start time of the event.
+    int64_t m_start;
+};
+
+//! @brief Traces an instant event with given name and argument.
+inline void instant(char const* name, int64_t arg) {
+    registry::local().push({name, registry::instance().now(), -1, arg});
+}
+
+//! @brief A log schedule S tracing its log events (with their simulated time), and its lifetime as a simulation.
+template <typename S>
+class traced_schedule : public S {
+  public:
+    //! @brief The constructors of the schedule.
+    using S::S;
+
+    //! @brief Steps over the next log event, tracing it.
+    template <typename G>
+    void step(G&& g) {
+        instant("log", int64_t(S::next()));
+        S::step(std::forward<G>(g));
+    }
+
+    //! @brief Returns the next log event, stepping over it.
+    template <typename G>
+    auto operator()(G&& g) -> decltype(S::next()) {
+        auto t = S::next();
+        step(std::forward<G>(g));
+        return t;
+    }
+
+  private:
+    //! @brief Traces the simulation.
+    scope m_simulation{"batch", registry::instance().simulation()};
+};
+
+
+}
+
+
+}
+
+//! @brief Concatenates tokens after macro expansion.
+#define FCPP_EVENT_TRACE_CAT(x, y)      FCPP_EVENT_TRACE_CAT_(x, y)
+//! @brief Concatenates tokens.
+#define FCPP_EVENT_TRACE_CAT_(x, y)     x##y
+//! @brief Traces the rest of the current block as an event with given name and numeric argument.
+#define TRACE_SCOPE(name, arg)          fcpp::tracing::scope FCPP_EVENT_TRACE_CAT(trace_scope_, __LINE__){name, int64_t(arg)}
+//! @brief Traces an instant event with given name and numeric argument.
+#define TRACE_EVENT(name, arg)          fcpp::tracing::instant(name, int64_t(arg))
+//! @brief Sets the MPI rank of the current process.
+#define TRACE_RANK(rank)                fcpp::tracing::registry::instance().rank(rank)
+
+#else
+
+//! @brief Traces the rest of the current block as an event with given name and numeric argument (disabled).
+#define TRACE_SCOPE(name, arg)
+//! @brief Traces an instant event with given name and numeric argument (disabled).
+#define TRACE_EVENT(name, arg)
+//! @brief Sets the MPI rank of the current process (disabled).
+#define TRACE_RANK(rank)
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Namespace containing tracing tools.
+namespace tracing {
+
+
+//! @brief A log schedule S tracing its log events (disabled).
+template <typename S>
+using traced_schedule = S;
+
+
+}
+
+
+}
+
+#endif
+
+#endif // FCPP_TRACING_H_
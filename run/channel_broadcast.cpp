@@ -9,6 +9,9 @@ using namespace coordination::tags;
 
 constexpr size_t dim = 3;
 
+//! @brief Total size of messages exchanged per unit of time.
+struct avg_msg_exchanged {};
+
 using round_s = sequence::periodic<
     distribution::interval_n<times_t, 0, 1>,
     distribution::weibull_n<times_t, 10, 1, 10>
@@ -16,9 +19,17 @@ using round_s = sequence::periodic<
 
 using rectangle_d = distribution::rect_n<1, 0, 0, 0, side, side, height>;
 
-using aggregator_t = aggregators<in_channel, aggregator::mean<double>>;
+using aggregator_t = aggregators<
+    in_channel,     aggregator::mean<double>,
+    elided_rounds,  aggregator::sum<size_t>,
+    max_msg,        aggregator::max<size_t>,
+    tot_msg,        aggregator::sum<size_t>
+>;
+
+template <typename... Ts>
+using lines_t = plot::join<plot::values<aggregator_t, common::type_sequence<>, Ts>...>;
 
-using plot_t = plot::split<plot::time, plot::values<aggregator_t, common::type_sequence<>, in_channel>>;
+using plot_t = plot::split<plot::time, plot::join<lines_t<in_channel, elided_rounds, max_msg>, plot::value<avg_msg_exchanged>>>;
 
 DECLARE_OPTIONS(opt,
     parallel<true>,
@@ -34,15 +45,25 @@ DECLARE_OPTIONS(opt,
         dest_distance,      double,
         distance_c,         color,
         size,               double,
-        node_shape,         shape
+        node_shape,         shape,
+        quiescence_tolerance, double,
+        export_precision,   double,
+        elided_rounds,      size_t,
+        max_msg,            size_t,
+        tot_msg,            size_t
     >,
     aggregator_t,
+    log_functors<
+        avg_msg_exchanged,  functor::div<functor::diff<aggregator::sum<tot_msg>>, distribution::constant_n<double, devices>>
+    >,
     init<
         x,                  rectangle_d
     >,
     plot_type<plot_t>,
     dimension<dim>,
     connector<connect::fixed<comm, 1, dim>>,
+    export_split<true>,
+    message_size<true>,
     shape_tag<node_shape>,
     size_tag<size>,
     color_tag<distance_c>
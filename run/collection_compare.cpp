@@ -7,7 +7,7 @@ using namespace fcpp;
 using namespace component::tags;
 using namespace coordination::tags;
 
-constexpr size_t algo       = 1;
+constexpr size_t algo       = 1; // use all_algorithms to compare them in a single run
 constexpr size_t device_num = 1000;
 constexpr size_t end_time   = 500;
 constexpr size_t maxX       = 2000;
@@ -35,6 +35,8 @@ DECLARE_OPTIONS(opt,
     spawn_schedule<spawn_s>,
     tuple_store<
         algorithm,  int,
+        side,       double,
+        speed,      double,
         spc_sum,    double,
         mpc_sum,    double,
         wmpc_sum,   double,
@@ -54,17 +56,29 @@ DECLARE_OPTIONS(opt,
         wmpc_max,   aggregator::max<double>,
         ideal_max,  aggregator::max<double>
     >,
+    option::extra_outputs,
     init<
         x,          rectangle_d,
-        algorithm,  distribution::constant_n<int, algo>
+        algorithm,  distribution::constant_n<int, algo>,
+        fixed_distances, distribution::constant_i<int, fixed_distances>,
+        side,       distribution::constant_n<double, maxX>,
+        speed,      distribution::constant_n<double, 61, 2>
     >,
-    connector<connect::fixed<100>>
+    connector<connect::fixed<100>>,
+    message_size<true>
 );
 
 int main() {
     using net_t = component::batch_simulator<opt>::net;
-    auto init_v = common::make_tagged_tuple<epsilon>(0.1);
-    net_t network{init_v};
-    network.run();
+    // runs with distances exchanged as doubles and as fixed-point values, reporting their message sizes
+    for (int f : {0, 1}) {
+        auto init_v = common::make_tagged_tuple<epsilon, fixed_distances>(0.1, f);
+        net_t network{init_v};
+        network.run();
+        size_t bytes = 0;
+        for (size_t i = 0; i < device_num; ++i)
+            bytes += network.node_at(i).storage(tot_msg{});
+        std::cout << (f ? "fixed-point" : "double") << " distances: " << double(bytes) / (device_num * end_time) << " bytes per device per second" << std::endl;
+    }
     return 0;
 }
@@ -0,0 +1,206 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file collection_compare_batch.cpp
+ * @brief Runs the collection comparison on a batch of scenarios (varying devices, strip length, speed and round variance), producing plots of errors and runtimes.
+ *
+ * Every run evaluates all distance algorithms on the same trajectories (`all_algorithms` mode).
+ * Since every panel of the plots varies a single parameter, only the runs varying one
+ * parameter from its default value are generated. The runtime of the program is measured
+ * in every round, and plotted as the average milliseconds per round.
+ */
+
+#include <chrono>
+
+#include "lib/collection_compare.hpp"
+
+using namespace fcpp;
+using namespace component::tags;
+using namespace coordination::tags;
+
+//! @brief The final simulation time.
+constexpr size_t end_time = 500;
+//! @brief Width of the deployment strip.
+constexpr size_t width = 200;
+
+//! @brief Ratios between the collected and ideal values, for a given algorithm.
+//! @{
+template <int a> struct spc_sum_ratio {};
+template <int a> struct mpc_sum_ratio {};
+template <int a> struct wmpc_sum_ratio {};
+template <int a> struct spc_max_ratio {};
+template <int a> struct mpc_max_ratio {};
+template <int a> struct wmpc_max_ratio {};
+//! @}
+
+//! @brief Total runtime of the rounds of the node (in seconds).
+struct runtime {};
+//! @brief Total number of rounds of the node.
+struct rounds {};
+//! @brief Average runtime of a round (in milliseconds).
+struct round_time {};
+
+//! @brief The main program, accumulating its runtime and number of rounds in the node storage.
+struct timed_main {
+    //! @brief Round function (running the main function of the case study).
+    template <typename node_t>
+    void operator()(node_t& node, times_t t) {
+        auto start = std::chrono::high_resolution_clock::now();
+        coordination::main{}(node, t);
+        node.storage(runtime{}) += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        node.storage(rounds{}) += 1;
+    }
+};
+
+//! @brief The randomised sequence of rounds for every node (about one every second, with deviation equal to tvar divided by 100).
+using round_s = sequence::periodic<
+    distribution::interval_n<times_t, 0, 1>,
+    distribution::weibull<
+        distribution::constant_n<double, 1>,
+        functor::div<distribution::constant_i<double, tvar>, distribution::constant_n<double, 100>>
+    >,
+    distribution::constant_n<times_t, end_time+2>
+>;
+//! @brief The sequence of network snapshots (one every 10 simulated seconds).
+using log_s = sequence::periodic_n<1, 0, 10, end_time>;
+//! @brief The sequence of node generation events (multiple devices all generated at time 0).
+using spawn_s = sequence::multiple<
+    distribution::constant_i<size_t, devices>,
+    distribution::constant_n<double, 0>
+>;
+//! @brief The distribution of initial node positions (random in the strip).
+using rectangle_d = distribution::rect<
+    distribution::constant_n<double, 0>,
+    distribution::constant_n<double, 0>,
+    distribution::constant_i<double, side>,
+    distribution::constant_n<double, width>
+>;
+//! @brief The ratios logged as rows.
+template <typename... Ts>
+using rows_t = plot::join<plot::value<Ts>...>;
+//! @brief The ratios to the ideal value of sums and maximums, for a given algorithm.
+template <int a>
+using ratios_t = rows_t<spc_sum_ratio<a>, mpc_sum_ratio<a>, wmpc_sum_ratio<a>, spc_max_ratio<a>, mpc_max_ratio<a>, wmpc_max_ratio<a>>;
+//! @brief Plots of given rows by every parameter, after the first 50 simulated seconds.
+template <typename R>
+using panels_t = plot::filter<plot::time, filter::above<50>, plot::join<
+    plot::split<devices, plot::filter<side, filter::equal<2000>, speed, filter::equal<30>, tvar, filter::equal<25>, R>>,
+    plot::split<side,    plot::filter<devices, filter::equal<1000>, speed, filter::equal<30>, tvar, filter::equal<25>, R>>,
+    plot::split<speed,   plot::filter<devices, filter::equal<1000>, side, filter::equal<2000>, tvar, filter::equal<25>, R>>,
+    plot::split<tvar,    plot::filter<devices, filter::equal<1000>, side, filter::equal<2000>, speed, filter::equal<30>, R>>
+>>;
+//! @brief Plots of the ratios by every parameter, for a given algorithm.
+template <int a>
+using algorithm_plot_t = panels_t<ratios_t<a>>;
+//! @brief Combining the plots for every algorithm, and of the runtime.
+using plot_t = plot::join<algorithm_plot_t<0>, algorithm_plot_t<1>, algorithm_plot_t<2>, panels_t<rows_t<round_time>>>;
+
+//! @brief The ratios to the ideal value computed for a given algorithm.
+template <int a>
+DECLARE_OPTIONS(ratio_functors,
+    log_functors<
+        spc_sum_ratio<a>,   functor::div<aggregator::sum<by_algorithm<spc_sum, a>>,  aggregator::sum<ideal_sum>>,
+        mpc_sum_ratio<a>,   functor::div<aggregator::sum<by_algorithm<mpc_sum, a>>,  aggregator::sum<ideal_sum>>,
+        wmpc_sum_ratio<a>,  functor::div<aggregator::sum<by_algorithm<wmpc_sum, a>>, aggregator::sum<ideal_sum>>,
+        spc_max_ratio<a>,   functor::div<aggregator::max<by_algorithm<spc_max, a>>,  aggregator::max<ideal_max>>,
+        mpc_max_ratio<a>,   functor::div<aggregator::max<by_algorithm<mpc_max, a>>,  aggregator::max<ideal_max>>,
+        wmpc_max_ratio<a>,  functor::div<aggregator::max<by_algorithm<wmpc_max, a>>, aggregator::max<ideal_max>>
+    >
+);
+
+//! @brief The general simulation options.
+DECLARE_OPTIONS(opt,
+    parallel<false>,
+    synchronised<false>,
+    message_size<true>,
+    program<timed_main>,
+    exports<coordination::main_t>,
+    round_schedule<round_s>,
+    log_schedule<log_s>,
+    spawn_schedule<spawn_s>,
+    tuple_store<
+        algorithm,  int,
+        side,       double,
+        speed,      double,
+        spc_sum,    double,
+        mpc_sum,    double,
+        wmpc_sum,   double,
+        ideal_sum,  double,
+        spc_max,    double,
+        mpc_max,    double,
+        wmpc_max,   double,
+        ideal_max,  double,
+        runtime,    double,
+        rounds,     size_t
+    >,
+    aggregators<
+        spc_sum,    aggregator::sum<double>,
+        mpc_sum,    aggregator::sum<double>,
+        wmpc_sum,   aggregator::sum<double>,
+        ideal_sum,  aggregator::sum<double>,
+        spc_max,    aggregator::max<double>,
+        mpc_max,    aggregator::max<double>,
+        wmpc_max,   aggregator::max<double>,
+        ideal_max,  aggregator::max<double>,
+        runtime,    aggregator::sum<double>,
+        rounds,     aggregator::sum<size_t>
+    >,
+    option::extra_outputs,
+    ratio_functors<0>,
+    ratio_functors<1>,
+    ratio_functors<2>,
+    log_functors<
+        round_time, functor::div<functor::mul<aggregator::sum<runtime>, distribution::constant_n<double, 1000>>, aggregator::sum<rounds>>
+    >,
+    init<
+        x,          rectangle_d,
+        algorithm,  distribution::constant_n<int, all_algorithms>,
+        side,       distribution::constant_i<double, side>,
+        speed,      distribution::constant_i<double, speed>
+    >,
+    extra_info<
+        devices,    double,
+        side,       double,
+        speed,      double,
+        tvar,       double
+    >,
+    plot_type<plot_t>,
+    connector<connect::fixed<100>>
+);
+
+//! @brief Creates a sequence of runs for given parameter sequences, completing them with seeds and output settings.
+template <typename... Ts>
+auto sweep(plot_t& p, Ts const&... xs) {
+    return batch::make_tagged_tuple_sequence(
+        batch::arithmetic<seed>(0, 4, 1), // 5 different random seeds
+        xs...,
+        // generate output file name for the run
+        batch::stringify<output>("output/collection_compare_batch", "txt"),
+        batch::constant<plotter>(&p) // reference to the plotter object
+    );
+}
+
+int main() {
+    //! @brief Construct the plotter object.
+    plot_t p;
+    //! @brief The component type (batch simulator with given options).
+    using comp_t = component::batch_simulator<opt>;
+    //! @brief The list of initialisation values to be used for simulations (the default one, and 12 more varying a single parameter).
+    auto init_list = batch::make_tagged_tuple_sequences(
+        // the default parameters
+        sweep(p, batch::constant<devices, side, speed, tvar>(1000, 2000, 30, 25)),
+        // 3 more device numbers
+        sweep(p, batch::list<devices>(500, 1500, 2000),     batch::constant<side, speed, tvar>(2000, 30, 25)),
+        // 3 more strip lengths
+        sweep(p, batch::list<side>(1000, 3000, 4000),       batch::constant<devices, speed, tvar>(1000, 30, 25)),
+        // 4 more speeds
+        sweep(p, batch::list<speed>(0, 15, 45, 60),         batch::constant<devices, side, tvar>(1000, 2000, 25)),
+        // 2 more time variances
+        sweep(p, batch::list<tvar>(0, 50),                  batch::constant<devices, side, speed>(1000, 2000, 30))
+    );
+    //! @brief Runs the given simulations.
+    batch::run(comp_t{}, init_list);
+    //! @brief Builds the resulting plots.
+    std::cout << plot::file("collection_compare_batch", p.build());
+    return 0;
+}
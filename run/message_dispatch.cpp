@@ -58,6 +58,12 @@ DECLARE_OPTIONS(opt,
     spawn_schedule<sequence::multiple_n<devices, 0>>,
     tuple_store<
         speed,              double,
+        routing,            int,
+        pruning,            int,
+        traffic_seed,       uint32_t,
+        home,               vec<3>,
+        home_time,          times_t,
+        border_streaks,     coordination::table_t,
         max_msg,            size_t,
         tot_msg,            size_t,
         max_proc,           size_t,
@@ -81,7 +87,9 @@ DECLARE_OPTIONS(opt,
     >,
     init<
         x,                  rectangle_d,
-        speed,              distribution::constant_n<double, 1>
+        speed,              distribution::constant_n<double, 1>,
+        pruning,            distribution::constant_n<int, 1>,
+        traffic_seed,       distribution::constant_i<uint32_t, seed>
     >,
     plot_type<plot_t>,
     dimension<dim>,
@@ -97,7 +105,8 @@ int main() {
     std::cout << "/*\n";
     {
         using net_t = component::interactive_simulator<opt>::net;
-        auto init_v = common::make_tagged_tuple<name, epsilon, plotter>(
+        auto init_v = common::make_tagged_tuple<seed, name, epsilon, plotter>(
+            0,
             "Dispatch of Peer-to-peer Messages",
             0.1,
             &p
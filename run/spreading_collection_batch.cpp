@@ -5,22 +5,18 @@
  * @brief Runs multiple executions of the spreading collection case study non-interactively from the command line, producing overall plots.
  */
 
+#define FCPP_HEADLESS
+
 #include "lib/spreading_collection.hpp"
 
 using namespace fcpp;
 
-int main() {
-    //! @brief Construct the plotter object.
-    option::plot_t p;
-    //! @brief The component type (batch simulator with given options).
-    using comp_t = component::batch_simulator<option::list>;
-    //! @brief The list of initialisation values to be used for simulations.
-    auto init_list = batch::make_tagged_tuple_sequence(
+//! @brief Creates a sequence of runs for given parameter sequences, completing them with seeds, derived parameters and output settings.
+template <typename... Ts>
+auto sweep(option::plot_t& p, Ts const&... xs) {
+    return batch::make_tagged_tuple_sequence(
         batch::arithmetic<option::seed >(0, 9, 1),      // 10 different random seeds
-        batch::arithmetic<option::speed>(0, 48, 2, 10), // 25 different speeds
-        batch::arithmetic<option::dens >(5, 29, 1, 10), // 25 different densities
-        batch::arithmetic<option::hops >(1, 25, 1, 10), // 25 different hop sizes
-        batch::arithmetic<option::tvar >(0, 48, 2, 10), // 25 different time variances
+        xs...,
         // generate output file name for the run
         batch::stringify<option::output>("output/spreading_collection_batch", "txt"),
         // computes side length from hops
@@ -36,6 +32,36 @@ int main() {
         }),
         batch::constant<option::plotter>(&p) // reference to the plotter object
     );
+}
+
+int main() {
+    //! @brief Construct the plotter object.
+    option::plot_t p;
+    //! @brief The component type (batch simulator with given options).
+    using comp_t = component::batch_simulator<option::list, option::message_size<true>>;
+    /**
+     * @brief The list of initialisation values to be used for simulations.
+     *
+     * Every panel of plot_t varies a single parameter, with the others equal to 10:
+     * only those runs are generated (the default one, and 24 more values for each
+     * of the 4 parameters), instead of the full product of the parameter ranges.
+     */
+    auto init_list = batch::make_tagged_tuple_sequences(
+        // the default parameters
+        sweep(p, batch::constant<option::speed, option::dens, option::hops, option::tvar>(10, 10, 10, 10)),
+        // 24 more speeds
+        sweep(p, batch::arithmetic<option::speed>(0, 8, 2),   batch::constant<option::dens, option::hops, option::tvar>(10, 10, 10)),
+        sweep(p, batch::arithmetic<option::speed>(12, 48, 2), batch::constant<option::dens, option::hops, option::tvar>(10, 10, 10)),
+        // 24 more densities
+        sweep(p, batch::arithmetic<option::dens>(5, 9, 1),    batch::constant<option::speed, option::hops, option::tvar>(10, 10, 10)),
+        sweep(p, batch::arithmetic<option::dens>(11, 29, 1),  batch::constant<option::speed, option::hops, option::tvar>(10, 10, 10)),
+        // 24 more hop sizes
+        sweep(p, batch::arithmetic<option::hops>(1, 9, 1),    batch::constant<option::speed, option::dens, option::tvar>(10, 10, 10)),
+        sweep(p, batch::arithmetic<option::hops>(11, 25, 1),  batch::constant<option::speed, option::dens, option::tvar>(10, 10, 10)),
+        // 24 more time variances
+        sweep(p, batch::arithmetic<option::tvar>(0, 8, 2),    batch::constant<option::speed, option::dens, option::hops>(10, 10, 10)),
+        sweep(p, batch::arithmetic<option::tvar>(12, 48, 2),  batch::constant<option::speed, option::dens, option::hops>(10, 10, 10))
+    );
     //! @brief Runs the given simulations.
     batch::run(comp_t{}, init_list);
     //! @brief Builds the resulting plots.
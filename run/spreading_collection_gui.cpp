@@ -11,7 +11,7 @@ using namespace fcpp;
 
 int main() {
     //! @brief The network object type (interactive simulator with given options).
-    using net_t = component::interactive_simulator<option::list>::net;
+    using net_t = component::interactive_simulator<option::list, option::message_size<true>>::net;
     //! @brief The initialisation values (simulation name, texture of the reference plane, node movement speed).
     auto init_v = common::make_tagged_tuple<option::name, option::texture, option::speed, option::side, option::devices, option::tvar>(
         "Spreading-Collection Composition",
@@ -9,7 +9,11 @@
 #include <iomanip>
 #include <sstream>
 
+#define FCPP_HEADLESS
+
 #include "lib/spreading_collection.hpp"
+#include "lib/placement.hpp"
+#include "lib/shuffled_sequence.hpp"
 
 using namespace fcpp;
 
@@ -87,9 +91,12 @@ constexpr int runs = 5;
 //! @brief The rank of the master process.
 constexpr int rank_master = 0;
 
-//! @brief The number of MPI processes per node.
+//! @brief The number of MPI processes per node (socket placements confine every process to one socket, and run only if it is at least the number of sockets).
 constexpr int procs_per_node = 1;
 
+//! @brief The seed of the shuffle of the init sequences (the same in every process).
+constexpr uint64_t shuffle_seed = 42;
+
 //! @brief Runs a series of executions, storing times and checking correctness.
 template <bool seeds_first, typename F, typename... As>
 void runner(int rank, int max_seed, option::plot_t& q, std::string s, F&& f) {
@@ -97,6 +104,7 @@ void runner(int rank, int max_seed, option::plot_t& q, std::string s, F&& f) {
     std::vector<double> v;
     for (int i=0; i<runs; ++i) {
         batch::mpi_barrier();
+        TRACE_SCOPE("run", i);
         profiler t;
         option::plot_t p;
         auto init_list = init_lister<seeds_first>(p, max_seed);
@@ -131,6 +139,7 @@ int main() {
     // Sets up MPI.
     int rank, n_procs;
     batch::mpi_init(rank, n_procs);
+    TRACE_RANK(rank);
     int n_nodes = n_procs / procs_per_node;
     size_t threads_per_proc = std::thread::hardware_concurrency() / procs_per_node;
     if (rank == rank_master)
@@ -144,52 +153,65 @@ int main() {
         option::plot_t q;
         if (rank == rank_master) {
             multi_print("\n", scaling_name[s], " SCALING:");
+            TRACE_SCOPE("reference", s);
             profiler t;
             auto init_list = init_lister<true>(q, scaling_seeds[s]);
             batch::run(comp_type{}, common::tags::dynamic_execution{}, init_list);
             std::cerr << "reference plot computed in " << double(t) << "s" << std::endl;
         }
-        // Baselines with 1 CPU
-        if (n_nodes == 1) {
-            runner<true >(rank, scaling_seeds[s], q, "baseline seeds-first", [=](auto init_list){
-                batch::run(comp_type{}, common::tags::dynamic_execution{threads_per_proc,1}, init_list);
-            });
-            runner<false>(rank, scaling_seeds[s], q, "baseline seeds-last", [=](auto init_list){
-                batch::run(comp_type{}, common::tags::dynamic_execution{threads_per_proc,1}, init_list);
-            });
-            runner<true >(rank, scaling_seeds[s], q, "baseline seeds-first-shuffle", [=](auto init_list){
-                auto seq = make_tagged_tuple_sequences(init_list);
-                seq.shuffle();
-                batch::run(comp_type{}, common::tags::dynamic_execution{threads_per_proc,1}, seq);
-            });
-            runner<false>(rank, scaling_seeds[s], q, "baseline seeds-last-shuffle", [=](auto init_list){
-                auto seq = make_tagged_tuple_sequences(init_list);
-                seq.shuffle();
-                batch::run(comp_type{}, common::tags::dynamic_execution{threads_per_proc,1}, seq);
-            });
-        } else {
-            // Construct the plotter object.
-            option::plot_t p;
-            // MPI static seeds-first division.
-            runner<true >(rank, scaling_seeds[s], q, "static seeds-first", [=](auto init_list){
-                batch::run(comp_type{}, common::tags::distributed_execution{threads_per_proc, 1, 0.0, false}, init_list);
-            });
-            runner<false>(rank, scaling_seeds[s], q, "static seeds-last",  [=](auto init_list){
-                batch::run(comp_type{}, common::tags::distributed_execution{threads_per_proc, 1, 0.0, false}, init_list);
-            });
-            runner<true >(rank, scaling_seeds[s], q, "static seeds-shuffle", [=](auto init_list){
-                batch::run(comp_type{}, common::tags::distributed_execution{threads_per_proc, 1, 0.0, true}, init_list);
-            });
-            runner<true >(rank, scaling_seeds[s], q, "dynamic seeds-first", [=](auto init_list){
-                batch::run(comp_type{}, common::tags::distributed_execution{threads_per_proc, 1, 1.0, false}, init_list);
-            });
-            runner<false>(rank, scaling_seeds[s], q, "dynamic seeds-last", [=](auto init_list){
-                batch::run(comp_type{}, common::tags::distributed_execution{threads_per_proc, 1, 1.0, false}, init_list);
-            });
-            runner<false>(rank, scaling_seeds[s], q, "dynamic seeds-shuffle", [=](auto init_list){
-                batch::run(comp_type{}, common::tags::distributed_execution{threads_per_proc, 1, 1.0, true}, init_list);
-            });
+        // Runs every variant under every placement policy (socket placements only if they can cover every socket).
+        std::vector<placement> policies = {placement::os};
+        if (size_t(procs_per_node) >= socket_count())
+            policies.insert(policies.end(), {placement::socket, placement::physical});
+        else if (rank == rank_master)
+            multi_print("\nskipping socket placements: ", procs_per_node, " processes per node on ", socket_count(), " sockets");
+        for (placement pl : policies) {
+            size_t threads = place_process(pl, rank % procs_per_node, procs_per_node);
+            std::string name = placement_name(pl) + " placement, ";
+            if (rank == rank_master)
+                multi_print("\n", threads, " threads with ", name.substr(0, name.size()-2), ":");
+            // Baselines with 1 CPU
+            if (n_nodes == 1) {
+                runner<true >(rank, scaling_seeds[s], q, name + "baseline seeds-first", [=](auto init_list){
+                    batch::run(comp_type{}, common::tags::dynamic_execution{threads,1}, init_list);
+                });
+                runner<false>(rank, scaling_seeds[s], q, name + "baseline seeds-last", [=](auto init_list){
+                    batch::run(comp_type{}, common::tags::dynamic_execution{threads,1}, init_list);
+                });
+                // lazily shuffled, without materialising the sequence
+                runner<true >(rank, scaling_seeds[s], q, name + "baseline seeds-first-shuffle", [=](auto init_list){
+                    batch::run(comp_type{}, common::tags::dynamic_execution{threads,1}, make_shuffled_sequence(init_list, shuffle_seed));
+                });
+                runner<false>(rank, scaling_seeds[s], q, name + "baseline seeds-last-shuffle", [=](auto init_list){
+                    batch::run(comp_type{}, common::tags::dynamic_execution{threads,1}, make_shuffled_sequence(init_list, shuffle_seed));
+                });
+            } else {
+                // Construct the plotter object.
+                option::plot_t p;
+                // MPI static seeds-first division.
+                runner<true >(rank, scaling_seeds[s], q, name + "static seeds-first", [=](auto init_list){
+                    batch::run(comp_type{}, common::tags::distributed_execution{threads, 1, 0.0, false}, init_list);
+                });
+                runner<false>(rank, scaling_seeds[s], q, name + "static seeds-last",  [=](auto init_list){
+                    batch::run(comp_type{}, common::tags::distributed_execution{threads, 1, 0.0, false}, init_list);
+                });
+                // lazily shuffled in the same way by every process, without materialising the sequence
+                runner<true >(rank, scaling_seeds[s], q, name + "static seeds-shuffle", [=](auto init_list){
+                    batch::run(comp_type{}, common::tags::distributed_execution{threads, 1, 0.0, false}, make_shuffled_sequence(init_list, shuffle_seed));
+                });
+                runner<true >(rank, scaling_seeds[s], q, name + "dynamic seeds-first", [=](auto init_list){
+                    batch::run(comp_type{}, common::tags::distributed_execution{threads, 1, 1.0, false}, init_list);
+                });
+                runner<false>(rank, scaling_seeds[s], q, name + "dynamic seeds-last", [=](auto init_list){
+                    batch::run(comp_type{}, common::tags::distributed_execution{threads, 1, 1.0, false}, init_list);
+                });
+                runner<false>(rank, scaling_seeds[s], q, name + "dynamic seeds-shuffle", [=](auto init_list){
+                    batch::run(comp_type{}, common::tags::distributed_execution{threads, 1, 1.0, false}, make_shuffled_sequence(init_list, shuffle_seed));
+                });
+            }
         }
+        // Restores the original affinity for the next reference plot.
+        place_process(placement::os, rank % procs_per_node, procs_per_node);
     }
     batch::mpi_finalize();
     return 0;
@@ -5,13 +5,17 @@
  * @brief Runs a single execution of the spreading collection case study non-interactively from the command line.
  */
 
+#define FCPP_HEADLESS
+
 #include "lib/spreading_collection.hpp"
 
 using namespace fcpp;
 
 int main() {
     //! @brief The network object type (batch simulator with given options).
-    using net_t = component::batch_simulator<option::list>::net;
+    using net_t = component::batch_simulator<option::list, option::message_size<true>>::net;
+    //! @brief Reports the memory footprint of a node object (excluding dynamically allocated data).
+    std::cerr << "node size: " << sizeof(component::batch_simulator<option::list, option::message_size<true>>::node) << " bytes" << std::endl;
     //! @brief The initialisation values (node movement speed).
     auto init_v = common::make_tagged_tuple<option::speed, option::side, option::devices, option::tvar>(
         25,
@@ -0,0 +1,70 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "lib/fcpp.hpp"
+
+#include "test/test_net.hpp"
+#include "test/performance.hpp"
+
+#include "lib/channel_broadcast.hpp"
+#include "lib/execution_flags.hpp"
+
+using namespace fcpp;
+using namespace coordination::tags;
+using namespace component::tags;
+
+
+//! @brief The final time of performance runs.
+constexpr size_t end = 20;
+
+//! @brief The default maximum ratio between the time of performance runs and of their baseline.
+constexpr double default_budget = 8;
+
+DECLARE_OPTIONS(storage,
+    tuple_store<
+        in_channel,         bool,
+        source_distance,    double,
+        dest_distance,      double,
+        distance_c,         color,
+        size,               double,
+        node_shape,         shape,
+        quiescence_tolerance, double,
+        export_precision,   double,
+        elided_rounds,      size_t,
+        max_msg,            size_t,
+        tot_msg,            size_t
+    >
+);
+
+template <int O, typename P, typename E>
+DECLARE_OPTIONS(perf_options,
+    program<P>,
+    round_schedule<sequence::periodic<
+        distribution::interval_n<times_t, 0, 1>,
+        distribution::weibull_n<times_t, 10, 1, 10>,
+        distribution::constant_n<times_t, end+2>
+    >>,
+    spawn_schedule<sequence::multiple_n<devices, 0>>,
+    exports<E>,
+    storage,
+    init<
+        x,  distribution::rect_n<1, 0, 0, 0, side, side, height>
+    >,
+    dimension<3>,
+    connector<connect::fixed<comm, 1, 3>>,
+    message_size<true>,
+    option::flags<O>
+);
+template <int O>
+using perf_combo = component::batch_simulator<perf_options<O, coordination::main, coordination::main_t>>;
+template <int O>
+using perf_baseline = component::batch_simulator<perf_options<O, coordination::idle, coordination::idle_t>>;
+
+
+MULTI_TEST(ChannelBroadcastPerf, Performance, O, 5) {
+    std::stringstream log;
+    EXPECT_PERF(typename perf_combo<O>::net, typename perf_baseline<O>::net, common::make_tagged_tuple<output>(&log), default_budget);
+}
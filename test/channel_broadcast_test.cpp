@@ -0,0 +1,81 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "lib/fcpp.hpp"
+
+#include "test/test_net.hpp"
+
+#include "lib/channel_broadcast.hpp"
+#include "lib/execution_flags.hpp"
+
+using namespace fcpp;
+using namespace coordination::tags;
+using namespace component::tags;
+
+
+DECLARE_OPTIONS(storage,
+    tuple_store<
+        in_channel,         bool,
+        source_distance,    double,
+        dest_distance,      double,
+        distance_c,         color,
+        size,               double,
+        node_shape,         shape,
+        quiescence_tolerance, double,
+        export_precision,   double,
+        elided_rounds,      size_t,
+        max_msg,            size_t,
+        tot_msg,            size_t
+    >
+);
+
+template <int O>
+DECLARE_OPTIONS(options,
+    program<coordination::main>,
+    round_schedule<sequence::list<distribution::constant_n<times_t, 100>>>,
+    log_schedule<sequence::list<distribution::constant_n<times_t, 100>>>,
+    exports<coordination::main_t>,
+    storage,
+    dimension<3>,
+    message_size<true>,
+    option::flags<O>
+);
+template <int O>
+using combo = component::batch_simulator<options<O>>;
+
+
+MULTI_TEST(ChannelBroadcastTest, Channel, O, 5) {
+    // with and without compressed exports
+    for (double precision : {0.0, 0.01}) {
+        double ds[3], dd[3];
+        bool in[3];
+        test_net<combo<O>, std::tuple<double, bool, bool>()> n{
+            [&](auto& node){
+                node.storage(export_precision{}) = precision;
+                node.round_main(0.0);
+                ds[node.uid] = node.storage(source_distance{});
+                dd[node.uid] = node.storage(dest_distance{});
+                in[node.uid] = node.storage(in_channel{});
+                return std::make_tuple(
+                    node.storage(size{}),
+                    node.storage(source_distance{}) == 0,
+                    node.storage(dest_distance{}) == 0
+                );
+            }
+        };
+        for (int i = 0; i < 5; ++i)
+            EXPECT_ROUND(n, {30, 30, 10}, {true, false, false}, {false, true, false});
+        // distances between source and destination are finite and symmetric
+        EXPECT_TRUE(std::isfinite(ds[1]));
+        EXPECT_EQ(ds[1], dd[0]);
+        for (int i = 0; i < 3; ++i) {
+            // triangle inequality
+            EXPECT_GE(ds[i] + dd[i] + 1e-9, ds[1]);
+            // the channel contains the endpoints, and the nodes within the given width
+            EXPECT_EQ(in[i], i < 2 or ds[i] + dd[i] < ds[1] + 20);
+        }
+    }
+}
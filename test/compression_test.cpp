@@ -0,0 +1,85 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "lib/fcpp.hpp"
+
+#include "lib/compression.hpp"
+
+using namespace fcpp;
+
+
+//! @brief A field of codes, with a given code from device 1 only.
+field<delta_code> from_one(delta_code c) {
+    return fcpp::details::make_field(std::vector<device_t>{1}, std::vector<delta_code>{delta_code(), c});
+}
+
+//! @brief The value decoded for device 1.
+int64_t decoded(field<delta_base> const& b) {
+    return get<2>(fcpp::details::self(b, 1));
+}
+
+
+TEST(CompressionTest, RoundTrip) {
+    std::vector<int64_t> values{0, 1, -1, 63, -64, 64, -65, 1000, -1000, 123456789012, quantised_inf, -quantised_inf-1};
+    for (int64_t v : values)
+        for (bool key : {false, true}) {
+            delta_code c(127, key, v), d(0, not key, 42);
+            common::osstream os;
+            os << c;
+            // a header byte, followed by 7 bits of the zig-zag encoded value per byte
+            size_t bytes = 2;
+            for (uint64_t z = (uint64_t(v) << 1) ^ uint64_t(v >> 63); z >= 128; z >>= 7) ++bytes;
+            EXPECT_EQ(bytes, os.size());
+            common::isstream is(os.data());
+            is >> d;
+            EXPECT_EQ(c, d);
+        }
+    // small deltas fit in two bytes
+    common::osstream os;
+    os << delta_code(5, false, -64);
+    EXPECT_EQ(2u, os.size());
+}
+
+TEST(CompressionTest, Resync) {
+    field<delta_base> b(coordination::details::delta_none);
+    // the first key value is decoded, and deltas refer to it
+    b = coordination::details::delta_decode(from_one(delta_code(0, true, 100)), b);
+    EXPECT_EQ(100, decoded(b));
+    b = coordination::details::delta_decode(from_one(delta_code(0, false, 5)), b);
+    EXPECT_EQ(105, decoded(b));
+    b = coordination::details::delta_decode(from_one(delta_code(0, false, -7)), b);
+    EXPECT_EQ(93, decoded(b));
+    // deltas against a missed key value keep the latest decoded value
+    b = coordination::details::delta_decode(from_one(delta_code(1, false, 3)), b);
+    EXPECT_EQ(93, decoded(b));
+    b = coordination::details::delta_decode(from_one(delta_code(1, false, 4)), b);
+    EXPECT_EQ(93, decoded(b));
+    // until the next key value
+    b = coordination::details::delta_decode(from_one(delta_code(2, true, 300)), b);
+    EXPECT_EQ(300, decoded(b));
+    b = coordination::details::delta_decode(from_one(delta_code(2, false, 1)), b);
+    EXPECT_EQ(301, decoded(b));
+    // departed neighbours are dropped, and decoded from scratch when they come back
+    b = coordination::details::delta_decode(field<delta_code>(delta_code()), b);
+    EXPECT_EQ(coordination::details::delta_none, fcpp::details::self(b, 1));
+    b = coordination::details::delta_decode(from_one(delta_code(2, false, 1)), b);
+    EXPECT_EQ(coordination::details::delta_none, fcpp::details::self(b, 1));
+}
+
+TEST(CompressionTest, FixedPoint) {
+    using fp = fixed_point<uint16_t, 1, 10>;
+    EXPECT_EQ(2u, sizeof(fp));
+    EXPECT_DOUBLE_EQ(12.3, double(fp(12.34)));
+    EXPECT_DOUBLE_EQ(12.4, double(fp(12.36)));
+    EXPECT_DOUBLE_EQ(0, double(fp(-5)));
+    EXPECT_DOUBLE_EQ(6553.4, double(fp(6553.4)));
+    EXPECT_TRUE(std::isinf(double(fp(6553.6))));
+    EXPECT_TRUE(std::isinf(double(fp(std::numeric_limits<double>::infinity()))));
+    EXPECT_LT(fp(1), fp(1.1));
+    EXPECT_EQ(fp(1), fp(1.01));
+}
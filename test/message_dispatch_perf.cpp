@@ -0,0 +1,85 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "lib/fcpp.hpp"
+
+#include "test/test_net.hpp"
+#include "test/performance.hpp"
+
+#include "lib/execution_flags.hpp"
+#include "lib/message_dispatch.hpp"
+
+using namespace fcpp;
+using namespace coordination::tags;
+using namespace component::tags;
+
+
+//! @brief The final time of performance runs (messages are generated between times 10 and 50).
+constexpr size_t end = 60;
+
+//! @brief The default maximum ratio between the time of performance runs and of their baseline.
+constexpr double default_budget = 6;
+
+DECLARE_OPTIONS(storage,
+    tuple_store<
+        speed,              double,
+        routing,            int,
+        pruning,            int,
+        traffic_seed,       uint32_t,
+        home,               vec<3>,
+        home_time,          times_t,
+        border_streaks,     coordination::table_t,
+        max_msg,            size_t,
+        tot_msg,            size_t,
+        max_proc,           size_t,
+        tot_proc,           size_t,
+        first_delivery,     times_t,
+        sent_count,         size_t,
+        delivery_count,     size_t,
+        repeat_count,       size_t,
+        center_dist,        double,
+        node_color,         color,
+        left_color,         color,
+        right_color,        color,
+        node_size,          double,
+        node_shape,         shape
+    >
+);
+
+template <int O, typename P, typename E>
+DECLARE_OPTIONS(perf_options,
+    program<P>,
+    round_schedule<sequence::periodic<
+        distribution::interval_n<times_t, 0, 1>,
+        distribution::weibull_n<times_t, 10, 1, 10>,
+        distribution::constant_n<times_t, end+2>
+    >>,
+    spawn_schedule<sequence::multiple_n<devices, 0>>,
+    exports<E>,
+    storage,
+    init<
+        x,              distribution::rect_n<1, 0, 0, 0, side, side, height>,
+        speed,          distribution::constant_n<double, 1>,
+        routing,        distribution::constant_i<int, routing>,
+        pruning,        distribution::constant_n<int, 1>,
+        traffic_seed,   distribution::constant_i<uint32_t, seed>
+    >,
+    dimension<3>,
+    connector<connect::fixed<comm, 1, 3>>,
+    message_size<true>,
+    option::flags<O>
+);
+template <int O>
+using perf_combo = component::batch_simulator<perf_options<O, coordination::main, coordination::main_t>>;
+template <int O>
+using perf_baseline = component::batch_simulator<perf_options<O, coordination::idle, coordination::idle_t>>;
+
+
+
+MULTI_TEST(MessageDispatchPerf, Performance, O, 5) {
+    std::stringstream log;
+    EXPECT_PERF(typename perf_combo<O>::net, typename perf_baseline<O>::net, common::make_tagged_tuple<seed, output, routing>(0, &log, 0), default_budget);
+}
@@ -0,0 +1,143 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "lib/fcpp.hpp"
+
+#include "test/test_net.hpp"
+
+#include "lib/execution_flags.hpp"
+#include "lib/message_dispatch.hpp"
+
+using namespace fcpp;
+using namespace coordination::tags;
+using namespace component::tags;
+
+
+//! @brief The final time of full runs (messages are generated between times 10 and 50).
+constexpr size_t end = 60;
+
+DECLARE_OPTIONS(storage,
+    tuple_store<
+        speed,              double,
+        routing,            int,
+        pruning,            int,
+        traffic_seed,       uint32_t,
+        home,               vec<3>,
+        home_time,          times_t,
+        border_streaks,     coordination::table_t,
+        max_msg,            size_t,
+        tot_msg,            size_t,
+        max_proc,           size_t,
+        tot_proc,           size_t,
+        first_delivery,     times_t,
+        sent_count,         size_t,
+        delivery_count,     size_t,
+        repeat_count,       size_t,
+        center_dist,        double,
+        node_color,         color,
+        left_color,         color,
+        right_color,        color,
+        node_size,          double,
+        node_shape,         shape
+    >
+);
+
+template <int O>
+DECLARE_OPTIONS(options,
+    program<coordination::main>,
+    round_schedule<sequence::list<distribution::constant_n<times_t, 100>>>,
+    log_schedule<sequence::list<distribution::constant_n<times_t, 100>>>,
+    exports<coordination::main_t>,
+    storage,
+    dimension<3>,
+    message_size<true>,
+    option::flags<O>
+);
+template <int O>
+using combo = component::batch_simulator<options<O>>;
+
+template <int O>
+DECLARE_OPTIONS(run_options,
+    program<coordination::main>,
+    round_schedule<sequence::periodic<
+        distribution::interval_n<times_t, 0, 1>,
+        distribution::weibull_n<times_t, 10, 1, 10>,
+        distribution::constant_n<times_t, end+2>
+    >>,
+    spawn_schedule<sequence::multiple_n<devices, 0>>,
+    exports<coordination::main_t>,
+    storage,
+    init<
+        x,              distribution::rect_n<1, 0, 0, 0, side, side, height>,
+        speed,          distribution::constant_i<double, speed>,
+        routing,        distribution::constant_i<int, routing>,
+        pruning,        distribution::constant_i<int, pruning>,
+        traffic_seed,   distribution::constant_i<uint32_t, seed>
+    >,
+    dimension<3>,
+    connector<connect::fixed<comm, 1, 3>>,
+    message_size<true>,
+    option::flags<O>
+);
+template <int O>
+using run_combo = component::batch_simulator<run_options<O>>;
+
+
+MULTI_TEST(MessageDispatchTest, Rendering, O, 5) {
+    test_net<combo<O>, std::tuple<double, size_t>()> n{
+        [&](auto& node){
+            node.round_main(0.0);
+            return std::make_tuple(
+                node.storage(node_size{}),
+                node.storage(sent_count{})
+            );
+        }
+    };
+    EXPECT_ROUND(n, {16, 10, 10}, {0, 0, 0});
+    EXPECT_ROUND(n, {16, 10, 10}, {0, 0, 0});
+    EXPECT_ROUND(n, {16, 10, 10}, {0, 0, 0});
+}
+
+MULTI_TEST(MessageDispatchTest, Deliveries, O, 5) {
+    // both routing modes, with the speed of message_dispatch and the default speed of spreading_collection
+    for (int r = 0; r < 2; ++r) for (double v : {1, 10}) {
+        std::stringstream log;
+        typename run_combo<O>::net network{common::make_tagged_tuple<seed, output, routing, speed, pruning>(0, &log, r, v, 1)};
+        network.run();
+        size_t sent = 0, delivered = 0, procs = 0;
+        double delay = 0;
+        for (size_t i = 0; i < devices; ++i) {
+            auto& n = network.node_at(i);
+            sent += n.storage(sent_count{});
+            delivered += n.storage(delivery_count{});
+            procs += n.storage(tot_proc{});
+            delay += n.storage(first_delivery{});
+        }
+        // messages are sent, and most of them reach their destination before their processes expire
+        EXPECT_LT(0u, sent);
+        EXPECT_LE(delivered, sent);
+        EXPECT_LE(sent, 2 * delivered);
+        EXPECT_LT(0u, procs);
+        EXPECT_LT(0, delay);
+        EXPECT_LT(delay / delivered, process_ttl);
+    }
+}
+
+MULTI_TEST(MessageDispatchTest, Pruning, O, 5) {
+    // pruning processes does not lose deliveries, in both routing modes
+    for (int r = 0; r < 2; ++r) {
+        size_t delivered[2] = {0, 0};
+        for (int p = 0; p < 2; ++p) {
+            std::stringstream log;
+            typename run_combo<O>::net network{common::make_tagged_tuple<seed, output, routing, speed, pruning>(0, &log, r, 1, p)};
+            network.run();
+            for (size_t i = 0; i < devices; ++i)
+                delivered[p] += network.node_at(i).storage(delivery_count{});
+        }
+        EXPECT_LT(0u, delivered[0]);
+        EXPECT_EQ(delivered[0], delivered[1]);
+    }
+}
@@ -0,0 +1,89 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+/**
+ * @file performance.hpp
+ * @brief Helpers for performance regression tests, timing full runs of a network against a baseline.
+ *
+ * The budget of every test is a ratio to the time of a baseline network, with the same
+ * options but running the empty `coordination::idle` program, so that it does not depend
+ * on the speed of the machine running the tests. The measured ratio is printed, so that
+ * the budgets can be recalibrated whenever the programs change; the budget of every test
+ * can also be overridden through the `FCPP_PERF_BUDGET` environment variable.
+ *
+ * Since they check wall-clock times, these tests are not part of the default test targets:
+ * they are built by CMake only with the `FCPP_PERF_TESTS` option, and are tagged `manual`
+ * (and `perf`) in Bazel.
+ */
+
+#ifndef FCPP_TEST_PERFORMANCE_H_
+#define FCPP_TEST_PERFORMANCE_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "lib/fcpp.hpp"
+
+
+/**
+ * @brief Namespace containing all the objects in the FCPP library.
+ */
+namespace fcpp {
+
+
+//! @brief Namespace containing the libraries of coordination routines.
+namespace coordination {
+
+
+//! @brief Empty program, run by the baseline networks of performance tests.
+struct idle {
+    //! @brief Round function (doing nothing).
+    template <typename node_t>
+    void operator()(node_t&, times_t) {}
+};
+//! @brief Exports for the idle program (none).
+FUN_EXPORT idle_t = common::export_list<>;
+
+
+}
+
+
+}
+
+
+//! @brief The maximum ratio to the baseline for a performance test (the `FCPP_PERF_BUDGET` environment variable if set, the given default otherwise).
+inline double perf_budget(double def) {
+    char const* s = std::getenv("FCPP_PERF_BUDGET");
+    return s == nullptr ? def : std::atof(s);
+}
+
+//! @brief Runs a network of type N constructed from given initialisation values three times, returning the minimum elapsed seconds.
+template <typename N, typename T>
+double perf_run(T const& init) {
+    double best = 0;
+    for (int i = 0; i < 3; ++i) {
+        auto start = std::chrono::high_resolution_clock::now();
+        {
+            N network{init};
+            network.run();
+        }
+        double t = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        best = i == 0 ? t : std::min(best, t);
+    }
+    return best;
+}
+
+//! @brief Ratio between the times of full runs of a network of type N and of a baseline network of type B.
+template <typename N, typename B, typename T>
+double perf_ratio(T const& init) {
+    double r = perf_run<N>(init) / perf_run<B>(init);
+    std::cout << "[   PERF   ] " << r << "x baseline" << std::endl;
+    return r;
+}
+
+//! @brief Checks that a full run of a network of type N takes at most `budget` times (unless overridden) a run of the baseline network of type B.
+#define EXPECT_PERF(N, B, init, budget)    EXPECT_LE((perf_ratio<N, B>(init)), perf_budget(budget))
+
+
+#endif // FCPP_TEST_PERFORMANCE_H_
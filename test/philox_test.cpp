@@ -0,0 +1,44 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "lib/philox.hpp"
+
+using namespace fcpp;
+
+
+TEST(PhiloxTest, KnownAnswers) {
+    // known-answer tests of Philox4x32-10 (from the Random123 distribution)
+    std::vector<philox> kat{
+        {0, 0, 0},
+        {0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF},
+        {0x299F31D0A4093822, 0x85A308D3243F6A88, 0x0370734413198A2E}
+    };
+    std::vector<std::vector<uint32_t>> answers{
+        {0x6627E8D5, 0xE169C58D, 0xBC57AC4C, 0x9B00DBD8},
+        {0x408F276D, 0x41C83B0E, 0xA20BC7C6, 0x6D5451FD},
+        {0xD16CFE09, 0x94FDCCEB, 0x5001E420, 0x24126EA1}
+    };
+    for (size_t i = 0; i < kat.size(); ++i)
+        for (uint32_t x : answers[i])
+            EXPECT_EQ(x, kat[i]());
+}
+
+TEST(PhiloxTest, Streams) {
+    philox a(42, 7), b(42, 7), c(42, 8), d(43, 7);
+    for (int i = 0; i < 10; ++i) {
+        uint32_t x = a();
+        EXPECT_EQ(x, b());
+        EXPECT_NE(x, c());
+        EXPECT_NE(x, d());
+    }
+    philox e(42, 7);
+    for (int i = 0; i < 1000; ++i) {
+        double r = e.next_real();
+        EXPECT_LE(0, r);
+        EXPECT_LT(r, 1);
+        EXPECT_LE(e.next_int(9), 9u);
+    }
+}
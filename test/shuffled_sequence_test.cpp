@@ -0,0 +1,89 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "lib/shuffled_sequence.hpp"
+
+using namespace fcpp;
+
+
+TEST(ShuffledSequenceTest, Permutation) {
+    for (int n : {1, 2, 3, 100, 1000}) {
+        std::vector<int> v(n);
+        for (int i = 0; i < n; ++i) v[i] = i;
+        auto s = make_shuffled_sequence(v, 42);
+        ASSERT_EQ(s.size(), size_t(n));
+        std::vector<int> w;
+        for (size_t i = 0; i < s.size(); ++i) w.push_back(s[i]);
+        if (n >= 100) {
+            EXPECT_NE(w, v);
+        }
+        std::sort(w.begin(), w.end());
+        EXPECT_EQ(w, v);
+    }
+}
+
+TEST(ShuffledSequenceTest, Seeds) {
+    std::vector<int> v(1000);
+    for (int i = 0; i < 1000; ++i) v[i] = i;
+    auto a = make_shuffled_sequence(v, 42);
+    auto b = make_shuffled_sequence(v, 42);
+    auto c = make_shuffled_sequence(v, 43);
+    std::vector<int> x, y, z;
+    for (size_t i = 0; i < a.size(); ++i) {
+        x.push_back(a[i]);
+        y.push_back(b[i]);
+        z.push_back(c[i]);
+    }
+    EXPECT_EQ(x, y);
+    EXPECT_NE(x, z);
+}
+
+TEST(ShuffledSequenceTest, Slices) {
+    std::vector<int> v(1000);
+    for (int i = 0; i < 1000; ++i) v[i] = i;
+    auto s = make_shuffled_sequence(v, 42);
+    // round-robin slices partition the view, as divided among processes
+    std::vector<int> w;
+    for (size_t k = 0; k < 3; ++k) {
+        auto t = s;
+        t.slice(k, t.size(), 3);
+        EXPECT_EQ(t.size(), (1000 - k + 2) / 3);
+        for (size_t i = 0; i < t.size(); ++i) {
+            EXPECT_EQ(s[k + 3*i], t[i]);
+            w.push_back(t[i]);
+        }
+    }
+    std::sort(w.begin(), w.end());
+    EXPECT_EQ(w, v);
+    // slices of slices, and empty slices
+    auto t = s;
+    t.slice(100, 900, 2);
+    t.slice(10, 20);
+    ASSERT_EQ(t.size(), 10u);
+    for (size_t i = 0; i < t.size(); ++i)
+        EXPECT_EQ(s[100 + 2*(10 + i)], t[i]);
+    t.slice(20, 30);
+    EXPECT_TRUE(t.empty());
+}
+
+TEST(ShuffledSequenceTest, Reshuffles) {
+    std::vector<int> v(1000);
+    for (int i = 0; i < 1000; ++i) v[i] = i;
+    auto s = make_shuffled_sequence(v, 42);
+    s.slice(0, 500);
+    std::vector<int> x;
+    for (size_t i = 0; i < s.size(); ++i) x.push_back(s[i]);
+    // shuffling a slice permutes its elements
+    s.shuffle(7);
+    ASSERT_EQ(s.size(), 500u);
+    std::vector<int> y;
+    for (size_t i = 0; i < s.size(); ++i) y.push_back(s[i]);
+    EXPECT_NE(x, y);
+    std::sort(x.begin(), x.end());
+    std::sort(y.begin(), y.end());
+    EXPECT_EQ(x, y);
+}
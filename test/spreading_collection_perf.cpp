@@ -0,0 +1,53 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "lib/fcpp.hpp"
+
+#include "test/test_net.hpp"
+#include "test/performance.hpp"
+
+#include "lib/execution_flags.hpp"
+#include "lib/spreading_collection.hpp"
+
+using namespace fcpp;
+using namespace coordination::tags;
+using namespace component::tags;
+
+
+//! @brief The default maximum ratio between the time of performance runs and of their baseline.
+constexpr double default_budget = 6;
+
+template <int O>
+DECLARE_OPTIONS(perf_options,
+    option::base,
+    option::flags<O>
+);
+template <int O>
+using perf_combo = component::batch_simulator<perf_options<O>>;
+
+//! @brief The options of the baseline (the program and exports given first take precedence over those in `option::base`).
+template <int O>
+DECLARE_OPTIONS(perf_baseline_options,
+    program<coordination::idle>,
+    exports<coordination::idle_t>,
+    option::base,
+    option::flags<O>
+);
+template <int O>
+using perf_baseline = component::batch_simulator<perf_baseline_options<O>>;
+
+
+MULTI_TEST(SpreadingCollectionPerf, Performance, O, 5) {
+    std::stringstream log;
+    auto init_v = common::make_tagged_tuple<option::speed, option::side, option::devices, option::tvar, output>(
+        25,
+        500,
+        100,
+        10,
+        &log
+    );
+    EXPECT_PERF(typename perf_combo<O>::net, typename perf_baseline<O>::net, init_v, default_budget);
+}
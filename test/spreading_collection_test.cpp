@@ -0,0 +1,79 @@
+// Copyright © 2026 Giorgio Audrito. All Rights Reserved.
+
+#include <algorithm>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "lib/fcpp.hpp"
+
+#include "test/test_net.hpp"
+
+#include "lib/execution_flags.hpp"
+#include "lib/spreading_collection.hpp"
+
+using namespace fcpp;
+using namespace coordination::tags;
+using namespace component::tags;
+
+
+template <int O>
+DECLARE_OPTIONS(options,
+    program<coordination::main>,
+    round_schedule<sequence::list<distribution::constant_n<times_t, 100>>>,
+    log_schedule<sequence::list<distribution::constant_n<times_t, 100>>>,
+    exports<coordination::main_t>,
+    option::store_t,
+    option::render_t,
+    dimension<3>,
+    message_size<true>,
+    option::flags<O>
+);
+template <int O>
+using combo = component::batch_simulator<options<O>>;
+
+
+MULTI_TEST(SpreadingCollectionTest, Diameter, O, 5) {
+    double dist[3], sdiam[3], diam[3];
+    test_net<combo<O>, std::tuple<double, bool, bool>()> n{
+        [&](auto& node){
+            node.round_main(0.0);
+            dist[node.uid]  = node.storage(calc_distance{});
+            sdiam[node.uid] = node.storage(source_diameter{});
+            diam[node.uid]  = node.storage(diameter{});
+            return std::make_tuple(
+                node.storage(node_size{}),
+                node.storage(calc_distance{}) == 0,
+                node.storage(true_distance{}) == 0
+            );
+        }
+    };
+    for (int i = 0; i < 10; ++i)
+        EXPECT_ROUND(n, {20, 10, 10}, {true, false, false}, {true, false, false});
+    // the diameter is collected in the source and broadcast to every node
+    double d = std::max(std::max(dist[0], dist[1]), dist[2]);
+    EXPECT_TRUE(std::isfinite(d));
+    EXPECT_LT(0, d);
+    EXPECT_EQ(d, sdiam[0]);
+    for (int i = 0; i < 3; ++i)
+        EXPECT_EQ(d, diam[i]);
+}
+
+MULTI_TEST(SpreadingCollectionTest, Quiescence, O, 5) {
+    for (double tolerance : {0.0, 1e-6}) {
+        size_t elided[3];
+        test_net<combo<O>, std::tuple<bool>()> n{
+            [&](auto& node){
+                node.storage(quiescence_tolerance{}) = tolerance;
+                node.round_main(0.0);
+                elided[node.uid] = node.storage(elided_rounds{});
+                return std::make_tuple(node.storage(calc_distance{}) == 0);
+            }
+        };
+        for (int i = 0; i < 20; ++i)
+            EXPECT_ROUND(n, {true, false, false});
+        // once the static network has converged, rounds are elided if and only if enabled
+        for (int i = 0; i < 3; ++i)
+            EXPECT_EQ(tolerance > 0, elided[i] > 0);
+    }
+}
@@ -1,5 +1,8 @@
 // Copyright © 2020 Giorgio Audrito. All Rights Reserved.
 
+#include <array>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "lib/fcpp.hpp"
@@ -20,10 +23,13 @@ DECLARE_OPTIONS(options,
     log_schedule<sequence::list<distribution::constant_n<times_t, 100>>>,
     exports<
         device_t, double, field<double>, vec<2>,
-        tuple<double,device_t>, tuple<double,int>, tuple<double,double>
+        tuple<double,device_t>, tuple<double,int>, tuple<double,double>,
+        coordination::case_studies_t<fixed_distance>
     >,
     tuple_store<
         algorithm,  int,
+        side,       double,
+        speed,      double,
         spc_sum,    double,
         mpc_sum,    double,
         wmpc_sum,   double,
@@ -33,6 +39,8 @@ DECLARE_OPTIONS(options,
         wmpc_max,   double,
         ideal_max,  double
     >,
+    option::extra_outputs,
+    message_size<true>,
     export_pointer<(O & 1) == 1>,
     export_split<(O & 2) == 2>,
     online_drop<(O & 4) == 4>,
@@ -42,6 +50,32 @@ DECLARE_OPTIONS(options,
 template <int O>
 using combo = component::batch_simulator<options<O>>;
 
+//! @brief Runs 10 rounds with a given algorithm setting, returning the outputs of kind K of both case studies in every device.
+template <int O, typename K>
+std::vector<std::array<double, 6>> case_outputs(int algo) {
+    std::vector<std::array<double, 6>> r(3);
+    test_net<combo<O>, std::tuple<double>()> n{
+        [&](auto& node){
+            node.storage(algorithm{}) = algo;
+            node.round_main(0.0);
+            r[node.uid] = {
+                node.storage(coordination::output_tag<K, spc_sum>{}),
+                node.storage(coordination::output_tag<K, mpc_sum>{}),
+                node.storage(coordination::output_tag<K, wmpc_sum>{}),
+                node.storage(coordination::output_tag<K, spc_max>{}),
+                node.storage(coordination::output_tag<K, mpc_max>{}),
+                node.storage(coordination::output_tag<K, wmpc_max>{})
+            };
+            return std::make_tuple(
+                node.storage(ideal_sum{})
+            );
+        }
+    };
+    for (int i = 0; i < 10; ++i)
+        EXPECT_ROUND(n, {1, 1, 1});
+    return r;
+}
+
 
 MULTI_TEST(CollectionCompareTest, ShortLine, O, 5) {
     test_net<combo<O>, std::tuple<double>()> n{
@@ -58,3 +92,37 @@ MULTI_TEST(CollectionCompareTest, ShortLine, O, 5) {
     EXPECT_ROUND(n, {1, 1, 1});
     EXPECT_ROUND(n, {1, 1, 1});
 }
+
+MULTI_TEST(CollectionCompareTest, AllAlgorithms, O, 5) {
+    // every algorithm has the same outputs when run alone and together with the others
+    EXPECT_EQ((case_outputs<O, coordination::plain_outputs>(0)), (case_outputs<O, coordination::algorithm_outputs<0>>(all_algorithms)));
+    EXPECT_EQ((case_outputs<O, coordination::plain_outputs>(1)), (case_outputs<O, coordination::algorithm_outputs<1>>(all_algorithms)));
+    EXPECT_EQ((case_outputs<O, coordination::plain_outputs>(2)), (case_outputs<O, coordination::algorithm_outputs<2>>(all_algorithms)));
+}
+
+MULTI_TEST(CollectionCompareTest, FixedDistances, O, 5) {
+    // device counting with distances exchanged as doubles and as fixed-point values
+    double counts[2][3];
+    size_t bytes[2][3];
+    for (int f = 0; f < 2; ++f) {
+        test_net<combo<O>, std::tuple<double>()> n{
+            [&](auto& node){
+                node.storage(algorithm{}) = 1;
+                node.storage(fixed_distances{}) = f;
+                node.round_main(0.0);
+                counts[f][node.uid] = node.storage(spc_sum{});
+                bytes[f][node.uid] = node.storage(tot_msg{});
+                return std::make_tuple(
+                    node.storage(ideal_sum{})
+                );
+            }
+        };
+        for (int i = 0; i < 10; ++i)
+            EXPECT_ROUND(n, {1, 1, 1});
+    }
+    // the same counts are computed, with smaller messages
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(counts[0][i], counts[1][i]);
+        EXPECT_LT(bytes[1][i], bytes[0][i]);
+    }
+}